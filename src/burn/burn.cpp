@@ -22,6 +22,7 @@ UINT32 nBurnDrvActive = ~0U;	// Which game driver is selected
 UINT32 nBurnDrvSelect[8] = { ~0U, ~0U, ~0U, ~0U, ~0U, ~0U, ~0U, ~0U }; // Which games are selected (i.e. loaded but not necessarily active)
 									
 bool bBurnUseMMX;
+bool bBurnUseAVX2;
 #if defined BUILD_A68K
 bool bBurnUseASMCPUEmulation = false;
 #endif
@@ -36,6 +37,7 @@ UINT32 nFramesEmulated;		// Counters for FPS	display
 UINT32 nFramesRendered;		//
 bool bForce60Hz = false;
 bool bBurnUseBlend = true;
+bool bBurnHandlerProfile = false;
 INT32 nBurnFPS = 6000;
 INT32 nBurnCPUSpeedAdjust = 0x0100;	// CPU speed adjustment (clock * nBurnCPUSpeedAdjust / 0x0100)
 
@@ -60,6 +62,16 @@ bool bSaveCRoms = 0;
 
 UINT32 *pBurnDrvPalette;
 
+void (__cdecl *BurnThreadRun)(void (*pJob)(void* pParam, INT32 nJob), void* pParam, INT32 nJobs) = NULL;
+INT32 nBurnThreads = 1;
+
+void* (__cdecl *BurnThreadStart)(void (*pFn)(void* pParam), void* pParam) = NULL;
+void (__cdecl *BurnThreadJoin)(void* pThread) = NULL;
+void* (__cdecl *BurnEventNew)() = NULL;
+void (__cdecl *BurnEventFree)(void* pEvent) = NULL;
+void (__cdecl *BurnEventSet)(void* pEvent) = NULL;
+void (__cdecl *BurnEventWait)(void* pEvent) = NULL;
+
 bool BurnCheckMMXSupport()
 {
 #if defined BUILD_X86_ASM
@@ -73,6 +85,17 @@ bool BurnCheckMMXSupport()
 #endif
 }
 
+bool BurnCheckAVX2Support()
+{
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+	__builtin_cpu_init();
+
+	return __builtin_cpu_supports("avx2");					// also checks the OS saves the ymm registers
+#else
+	return 0;
+#endif
+}
+
 extern "C" INT32 BurnLibInit()
 {
 	BurnLibExit();
@@ -80,6 +103,7 @@ extern "C" INT32 BurnLibInit()
 
 	cmc_4p_Precalc();
 	bBurnUseMMX = BurnCheckMMXSupport();
+	bBurnUseAVX2 = BurnCheckAVX2Support();
 
 	return 0;
 }
@@ -585,6 +609,26 @@ extern "C" INT32 BurnDrvGetFamilyFlags()
 	return pDriver[nBurnDrvActive]->Family;
 }
 
+// Set by drivers whose scan can be replaced by a cached list of areas, and by the cores and devices
+// which rule that out again
+static INT32 bBurnAreaScanStatic = 0;
+static INT32 bBurnAreaScanDynamic = 0;
+
+void BurnAreaScanSetStatic()
+{
+	bBurnAreaScanStatic = 1;
+}
+
+void BurnAreaScanSetDynamic()
+{
+	bBurnAreaScanDynamic = 1;
+}
+
+INT32 BurnAreaScanIsStatic()
+{
+	return bBurnAreaScanStatic && !bBurnAreaScanDynamic;
+}
+
 // Init game emulation (loading any needed roms)
 extern "C" INT32 BurnDrvInit()
 {
@@ -643,6 +687,11 @@ extern "C" INT32 BurnDrvInit()
 	BurnInitMemoryManager();
 	BurnRandomInit();
 	BurnSoundDCFilterReset();
+	BurnSoundProfileInit();
+	BurnIdleInit();
+
+	bBurnAreaScanStatic = 0;
+	bBurnAreaScanDynamic = 0;
 
 	nReturnValue = pDriver[nBurnDrvActive]->Init();	// Forward to drivers function
 
@@ -680,6 +729,9 @@ extern "C" INT32 BurnDrvExit()
 	}
 #endif
 
+	BurnSoundProfileExit();
+	BurnIdleExit();
+
 	CheatExit();
 	CheatSearchExit();
 	HiscoreExit();
@@ -691,6 +743,7 @@ extern "C" INT32 BurnDrvExit()
 	
 	INT32 nRet = pDriver[nBurnDrvActive]->Exit();			// Forward to drivers function
 	
+	BurnSoundBusExit();
 	BurnExitMemoryManager();
 #if defined FBA_DEBUG
 	DebugTrackerExit();
@@ -737,7 +790,13 @@ extern "C" INT32 BurnDrvFrame()
 {
 	CheatApply();									// Apply cheats (if any)
 	HiscoreApply();
-	return pDriver[nBurnDrvActive]->Frame();		// Forward to drivers function
+	BurnIdleFrame();
+
+	UINT64 nProfile = BurnSoundProfileStart();
+	INT32 nRet = pDriver[nBurnDrvActive]->Frame();	// Forward to drivers function
+	BurnSoundProfileFrame(nProfile);
+
+	return nRet;
 }
 
 // Force redraw of the screen
@@ -861,6 +920,9 @@ INT32 BurnAreaScan(INT32 nAction, INT32* pnMin)
 {
 	INT32 nRet = 0;
 
+	// The sound chips rendered on a worker must be idle while their state is scanned
+	BurnSoundQueueSyncAll();
+
 	// Handle any MAME-style variables
 	if (nAction & ACB_DRIVER_DATA) {
 		nRet = BurnStateMAMEScan(nAction, pnMin);
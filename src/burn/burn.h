@@ -222,6 +222,7 @@ struct BurnDIPInfo {
 // ---------------------------------------------------------------------------
 
 extern bool bBurnUseMMX;
+extern bool bBurnUseAVX2;
 #ifdef BUILD_A68K
 extern bool bBurnUseASMCPUEmulation;
 #endif
@@ -256,6 +257,9 @@ extern INT16* pBurnSoundOut;				// Pointer to output buffer
 extern INT32 nInterpolation;					// Desired interpolation level for ADPCM/PCM sound
 extern INT32 nFMInterpolation;				// Desired interpolation level for FM sound
 
+extern INT32 nBurnSampleCacheSize;			// Most bytes of decoded samples kept in memory (0 = no limit)
+extern INT32 bBurnSampleCacheFile;			// Keep converted samples in a file next to the sample zip
+
 extern UINT32 *pBurnDrvPalette;
 
 #define PRINT_NORMAL	(0)
@@ -280,6 +284,31 @@ extern INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...);
 INT32 BurnLibInit();
 INT32 BurnLibExit();
 
+// Set by the frontend: calls pJob(pParam, n) for n = 0 to nJobs - 1 spread over nBurnThreads threads,
+// and returns when all of them are done. Left NULL, everything is drawn on the emulation thread.
+extern void (__cdecl *BurnThreadRun)(void (*pJob)(void* pParam, INT32 nJob), void* pParam, INT32 nJobs);
+extern INT32 nBurnThreads;
+extern bool bGenericTilemapThreads;		// draw line/column scrolled generic tilemaps with BurnThreadRun
+
+// Set by the frontend, for the sound chips rendered on a thread of their own (see BurnSoundQueue in
+// burn_sound.h): BurnThreadStart runs pFn(pParam) on a new thread and BurnThreadJoin waits for it to
+// return. An event is auto-reset: BurnEventWait returns once for every BurnEventSet, even one made
+// before the wait. Left NULL, all sound is rendered on the emulation thread.
+extern void* (__cdecl *BurnThreadStart)(void (*pFn)(void* pParam), void* pParam);
+extern void (__cdecl *BurnThreadJoin)(void* pThread);
+extern void* (__cdecl *BurnEventNew)();
+extern void (__cdecl *BurnEventFree)(void* pEvent);
+extern void (__cdecl *BurnEventSet)(void* pEvent);
+extern void (__cdecl *BurnEventWait)(void* pEvent);
+extern bool bBurnSoundThread;			// render the sound chips that support it on their own thread (from the next init)
+extern bool bBurnSoundProfile;			// time the sound chips and print a report at exit (from the next init)
+extern bool bBurnHandlerProfile;		// count the 68000 accesses that go through handlers and print a report at exit (from the next init)
+extern INT32 nBurnIdleMode;			// skip idle loops: 0 off, 1 unless the driver is on the deny list, 2 always (from the next init)
+
+extern bool bBurnTransferSkipRows;
+bool BurnTransferFrameUnchanged();
+void BurnTransferGetStats(UINT64* pnRows, UINT64* pnSkipped, UINT32* pnFrames, UINT32* pnUnchanged);
+
 INT32 BurnDrvInit();
 INT32 BurnDrvExit();
 
@@ -0,0 +1,224 @@
+// Idle loop detection (see burnint.h)
+#include "burnint.h"
+
+INT32 nBurnIdleMode = 0;
+
+#define IDLE_MAX_CPU		16
+#define IDLE_MAX_BODY		0x40		// longest loop watched, in bytes from the branch back to its target
+#define IDLE_PASSES			3			// identical passes in a row before the rest of the timeslice is skipped
+#define IDLE_MAX_LOOPS		8			// loops per cpu kept for the report
+
+#define IDLE_DENY			0
+#define IDLE_ALLOW			1
+
+// Drivers are looked up by name, then by parent, then by board rom, and the first match decides, so an
+// allow entry for a set overrides a deny entry for its parent or board.
+static const struct { const char* szName; INT32 nFlags; } IdleList[] = {
+	{ "pgm",		IDLE_DENY },	// the ARM7 protection handshakes with the 68000 in shared ram, and has its own idle loop hack
+	{ NULL,			0 }
+};
+
+struct IdleLoop {
+	UINT32 nPc;
+	UINT32 nSkips;
+	UINT64 nCycles;
+};
+
+struct IdleCpu {
+	cpu_core_config* pConfig;
+	const char* szName;
+	INT32 nCpu;
+
+	UINT32 nLastPc;
+	UINT32 nHead;						// target of the backward branch being watched
+	bool bHead;
+	bool bWrite;						// in this pass
+	INT32 nReads;						// in this pass
+	UINT32 nHash;						// of the addresses and data read in this pass
+	INT32 nPrevReads;
+	UINT32 nPrevHash;
+	UINT32 nPrevState;					// registers at the end of the last pass, so counted loops aren't idle
+	INT32 nPasses;						// identical passes in a row
+
+	UINT32 nSkips;
+	UINT64 nCycles;
+	IdleLoop Loops[IDLE_MAX_LOOPS];
+	INT32 nLoops;
+};
+
+static bool bIdleActive = false;
+static IdleCpu IdleCpus[IDLE_MAX_CPU];
+static INT32 nIdleCpus = 0;
+static UINT32 nIdleFrames = 0;
+
+static INT32 IdleListFind(const char* szName)
+{
+	if (szName == NULL) {
+		return -1;
+	}
+
+	for (INT32 i = 0; IdleList[i].szName; i++) {
+		if (strcmp(IdleList[i].szName, szName) == 0) {
+			return IdleList[i].nFlags;
+		}
+	}
+
+	return -1;
+}
+
+static bool IdleAllowed()
+{
+	if (nBurnIdleMode == 2) {			// all drivers, for trying out new list entries
+		return true;
+	}
+
+	INT32 nFlags = IdleListFind(BurnDrvGetTextA(DRV_NAME));
+	if (nFlags < 0) nFlags = IdleListFind(BurnDrvGetTextA(DRV_PARENT));
+	if (nFlags < 0) nFlags = IdleListFind(BurnDrvGetTextA(DRV_BOARDROM));
+
+	return nFlags != IDLE_DENY;
+}
+
+INT32 BurnIdleRegister(cpu_core_config* pConfig, const char* szName, INT32 nCpu)
+{
+	if (!bIdleActive || pConfig->skip == NULL || pConfig->state == NULL) {
+		return -1;
+	}
+
+	for (INT32 i = 0; i < nIdleCpus; i++) {
+		if (IdleCpus[i].pConfig == pConfig && IdleCpus[i].nCpu == nCpu) {
+			return i;
+		}
+	}
+
+	if (nIdleCpus == IDLE_MAX_CPU) {
+		return -1;
+	}
+
+	IdleCpu* pCpu = &IdleCpus[nIdleCpus];
+	memset(pCpu, 0, sizeof(IdleCpu));
+	pCpu->pConfig = pConfig;
+	pCpu->szName = szName;
+	pCpu->nCpu = nCpu;
+
+	return nIdleCpus++;
+}
+
+static void IdleSkip(IdleCpu* pCpu)
+{
+	INT32 nCycles = pCpu->pConfig->skip();
+
+	pCpu->nSkips++;
+	pCpu->nCycles += nCycles;
+
+	INT32 i = 0;
+	while (i < pCpu->nLoops && pCpu->Loops[i].nPc != pCpu->nHead) {
+		i++;
+	}
+	if (i < IDLE_MAX_LOOPS) {
+		if (i == pCpu->nLoops) {
+			pCpu->Loops[i].nPc = pCpu->nHead;
+			pCpu->nLoops++;
+		}
+		pCpu->Loops[i].nSkips++;
+		pCpu->Loops[i].nCycles += nCycles;
+	}
+
+	pCpu->nPasses = 0;
+}
+
+void BurnIdleFetch(INT32 nSlot, UINT32 nPc)
+{
+	IdleCpu* pCpu = &IdleCpus[nSlot];
+
+	if (nPc <= pCpu->nLastPc && pCpu->nLastPc - nPc < IDLE_MAX_BODY) {
+		// A short branch back: the end of a pass if it goes to the loop being watched, else a new loop
+		UINT32 nState = pCpu->pConfig->state();
+
+		if (pCpu->bHead && nPc == pCpu->nHead) {
+			if (!pCpu->bWrite && pCpu->nReads && pCpu->nReads == pCpu->nPrevReads && pCpu->nHash == pCpu->nPrevHash && nState == pCpu->nPrevState) {
+				if (++pCpu->nPasses >= IDLE_PASSES) {
+					IdleSkip(pCpu);
+				}
+			} else {
+				pCpu->nPasses = 0;
+			}
+		} else {
+			pCpu->nHead = nPc;
+			pCpu->bHead = true;
+			pCpu->nPasses = 0;
+		}
+
+		pCpu->nPrevReads = pCpu->nReads;
+		pCpu->nPrevHash = pCpu->nHash;
+		pCpu->nPrevState = nState;
+		pCpu->nReads = 0;
+		pCpu->nHash = 0;
+		pCpu->bWrite = false;
+	} else if (pCpu->bHead && (nPc < pCpu->nHead || nPc - pCpu->nHead >= IDLE_MAX_BODY)) {
+		// Left the loop (a call, an interrupt or the way out)
+		pCpu->bHead = false;
+	}
+
+	pCpu->nLastPc = nPc;
+}
+
+void BurnIdleRead(INT32 nSlot, UINT32 nAddress, UINT32 nData)
+{
+	IdleCpu* pCpu = &IdleCpus[nSlot];
+
+	pCpu->nReads++;
+	pCpu->nHash = ((pCpu->nHash << 5) | (pCpu->nHash >> 27)) ^ nAddress ^ (nData * 0x9e3779b9);
+}
+
+void BurnIdleWrite(INT32 nSlot)
+{
+	IdleCpus[nSlot].bWrite = true;
+}
+
+void BurnIdleInit()
+{
+	bIdleActive = nBurnIdleMode && IdleAllowed();
+	nIdleCpus = 0;
+	nIdleFrames = 0;
+}
+
+void BurnIdleFrame()
+{
+	if (!bIdleActive) {
+		return;
+	}
+
+	// Start every frame from scratch, so the skips only depend on the emulated state (run ahead, netplay)
+	for (INT32 i = 0; i < nIdleCpus; i++) {
+		IdleCpus[i].bHead = false;
+		IdleCpus[i].nPasses = 0;
+	}
+
+	nIdleFrames++;
+}
+
+void BurnIdleExit()
+{
+	if (!bIdleActive) {
+		return;
+	}
+
+	bIdleActive = false;
+
+	if (nIdleFrames == 0) {
+		return;
+	}
+
+	bprintf(PRINT_IMPORTANT, _T("Idle loops skipped in %u frames:\n"), nIdleFrames);
+
+	for (INT32 i = 0; i < nIdleCpus; i++) {
+		IdleCpu* pCpu = &IdleCpus[i];
+
+		bprintf(PRINT_IMPORTANT, _T("  %hs #%d: %u skips, %.0f cycles per frame\n"), pCpu->szName, pCpu->nCpu, pCpu->nSkips, (double)pCpu->nCycles / nIdleFrames);
+
+		for (INT32 j = 0; j < pCpu->nLoops; j++) {
+			bprintf(PRINT_IMPORTANT, _T("    loop at %08x: %u skips, %.0f cycles per frame\n"), pCpu->Loops[j].nPc, pCpu->Loops[j].nSkips, (double)pCpu->Loops[j].nCycles / nIdleFrames);
+		}
+	}
+}
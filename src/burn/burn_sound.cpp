@@ -59,3 +59,176 @@ void BurnSoundClear()
 	if (pBurnSoundOut)
 		memset(pBurnSoundOut, 0, nBurnSoundLen * 2 * sizeof(INT16));
 }
+
+// ----------------------------------------------------------------------------
+// 32-bit mixing bus
+
+INT32* pBurnSoundBus[2] = { NULL, NULL };
+static INT32 nBurnSoundBusLen = 0;
+
+void BurnSoundBusBegin(INT32 nLen)
+{
+	if (nLen > nBurnSoundBusLen) {
+		BurnSoundBusExit();
+
+		nBurnSoundBusLen = (nLen > nBurnSoundRate) ? nLen : nBurnSoundRate;
+		pBurnSoundBus[0] = (INT32*)BurnMalloc(nBurnSoundBusLen * sizeof(INT32));
+		pBurnSoundBus[1] = (INT32*)BurnMalloc(nBurnSoundBusLen * sizeof(INT32));
+	}
+
+	memset(pBurnSoundBus[0], 0, nLen * sizeof(INT32));
+	memset(pBurnSoundBus[1], 0, nLen * sizeof(INT32));
+}
+
+void BurnSoundBusAdd(INT16* pSrc, INT32 nLen)
+{
+	INT32* pLeft = pBurnSoundBus[0];
+	INT32* pRight = pBurnSoundBus[1];
+
+	for (INT32 i = 0; i < nLen; i++) {
+		pLeft[i] += pSrc[(i << 1) + 0] << 8;
+		pRight[i] += pSrc[(i << 1) + 1] << 8;
+	}
+}
+
+void BurnSoundBusFlush(INT16* pDest, INT32 nLen, INT32 bAdd)
+{
+	if (bAdd) {
+		BurnSoundCopyClamp_Stereo_Add_C(pBurnSoundBus[0], pBurnSoundBus[1], pDest, nLen);
+	} else {
+		BurnSoundCopyClamp_Stereo_C(pBurnSoundBus[0], pBurnSoundBus[1], pDest, nLen);
+	}
+}
+
+void BurnSoundBusExit()
+{
+	BurnFree(pBurnSoundBus[0]);
+	BurnFree(pBurnSoundBus[1]);
+
+	nBurnSoundBusLen = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Mixing and resampling of sound chip outputs
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_SOUND_SSE2
+ #include <emmintrin.h>
+#endif
+
+void BurnSoundInputSet(BurnSoundInput* pInput, INT16* pBuffer, double dVolume, INT32 nRouteDir)
+{
+	pInput->pBuffer[0] = pBuffer;
+	pInput->nBuffers = 1;
+	pInput->dGain[0] = ((nRouteDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) ? dVolume : 0.0;
+	pInput->dGain[1] = ((nRouteDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) ? dVolume : 0.0;
+}
+
+void BurnSoundInputSetLR(BurnSoundInput* pInput, INT16* pBuffer, double dLeftVolume, double dRightVolume)
+{
+	pInput->pBuffer[0] = pBuffer;
+	pInput->nBuffers = 1;
+	pInput->dGain[0] = dLeftVolume;
+	pInput->dGain[1] = dRightVolume;
+}
+
+void BurnSoundInputAddBuffer(BurnSoundInput* pInput, INT16* pBuffer)
+{
+	pInput->pBuffer[pInput->nBuffers++] = pBuffer;
+}
+
+static inline INT32 BurnSoundInputSample(const BurnSoundInput* pInput, INT32 n)
+{
+	INT32 nSample = pInput->pBuffer[0][n];
+
+	for (INT32 b = 1; b < pInput->nBuffers; b++) {
+		nSample += pInput->pBuffer[b][n];
+	}
+
+	return nSample;
+}
+
+static inline void BurnSoundStore(INT16* pDest, INT32 nLeftSample, INT32 nRightSample, INT32 nMode)
+{
+	nLeftSample = BURN_SND_CLIP(nLeftSample);
+	nRightSample = BURN_SND_CLIP(nRightSample);
+
+	switch (nMode) {
+		case BURN_SND_MIX_ADD:
+			pDest[0] = BURN_SND_CLIP(pDest[0] + nLeftSample);
+			pDest[1] = BURN_SND_CLIP(pDest[1] + nRightSample);
+			break;
+		case BURN_SND_MIX_ADD_NOCLIP:
+			pDest[0] += nLeftSample;
+			pDest[1] += nRightSample;
+			break;
+		default:
+			pDest[0] = nLeftSample;
+			pDest[1] = nRightSample;
+			break;
+	}
+}
+
+void BurnSoundMix(INT16* pDest, INT32 nStart, INT32 nEnd, const BurnSoundInput* pInputs, INT32 nInputs, INT32 nMode)
+{
+	for (INT32 n = nStart; n < nEnd; n++) {
+		INT32 nLeftSample = 0, nRightSample = 0;
+
+		for (INT32 c = 0; c < nInputs; c++) {
+			double dSample = BurnSoundInputSample(&pInputs[c], n);
+
+			nLeftSample += (INT32)(dSample * pInputs[c].dGain[0]);
+			nRightSample += (INT32)(dSample * pInputs[c].dGain[1]);
+		}
+
+		BurnSoundStore(pDest + (n << 1), nLeftSample, nRightSample, nMode);
+	}
+}
+
+UINT32 BurnSoundResample(INT16* pDest, INT32 nStart, INT32 nEnd, const BurnSoundInput* pInputs, INT32 nInputs, UINT32 nPosition, UINT32 nStep, INT32 nMode)
+{
+	for (INT32 n = nStart; n < nEnd; n++, nPosition += nStep) {
+		INT32 nPos = (nPosition >> 16) - 3;
+
+		// the 4 taps of each side, every tap is scaled and truncated on its own like the chip wrappers always did
+#if defined BURN_SOUND_SSE2
+		__m128i vLeft = _mm_setzero_si128();
+		__m128i vRight = _mm_setzero_si128();
+
+		for (INT32 c = 0; c < nInputs; c++) {
+			const BurnSoundInput* pInput = &pInputs[c];
+			__m128i vTaps = _mm_set_epi32(BurnSoundInputSample(pInput, nPos + 3), BurnSoundInputSample(pInput, nPos + 2), BurnSoundInputSample(pInput, nPos + 1), BurnSoundInputSample(pInput, nPos + 0));
+			__m128d vTaps01 = _mm_cvtepi32_pd(vTaps);
+			__m128d vTaps23 = _mm_cvtepi32_pd(_mm_shuffle_epi32(vTaps, 0x0e));
+			__m128d vGainLeft = _mm_set1_pd(pInput->dGain[0]);
+			__m128d vGainRight = _mm_set1_pd(pInput->dGain[1]);
+
+			vLeft = _mm_add_epi32(vLeft, _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_mul_pd(vTaps01, vGainLeft)), _mm_cvttpd_epi32(_mm_mul_pd(vTaps23, vGainLeft))));
+			vRight = _mm_add_epi32(vRight, _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_mul_pd(vTaps01, vGainRight)), _mm_cvttpd_epi32(_mm_mul_pd(vTaps23, vGainRight))));
+		}
+
+		INT32 nLeftSample[4], nRightSample[4];
+		_mm_storeu_si128((__m128i*)nLeftSample, vLeft);
+		_mm_storeu_si128((__m128i*)nRightSample, vRight);
+#else
+		INT32 nLeftSample[4] = {0, 0, 0, 0};
+		INT32 nRightSample[4] = {0, 0, 0, 0};
+
+		for (INT32 c = 0; c < nInputs; c++) {
+			for (INT32 t = 0; t < 4; t++) {
+				double dSample = BurnSoundInputSample(&pInputs[c], nPos + t);
+
+				nLeftSample[t] += (INT32)(dSample * pInputs[c].dGain[0]);
+				nRightSample[t] += (INT32)(dSample * pInputs[c].dGain[1]);
+			}
+		}
+#endif
+
+		INT32 nTotalLeftSample = INTERPOLATE4PS_16BIT((nPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
+		INT32 nTotalRightSample = INTERPOLATE4PS_16BIT((nPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
+
+		BurnSoundStore(pDest + (n << 1), nTotalLeftSample, nTotalRightSample, nMode);
+	}
+
+	return nPosition;
+}
@@ -1,6 +1,9 @@
 // burn_sound.h - General sound support functions
 // based on code by Daniel Moreno (ComaC) < comac2k@teleline.es >
 
+#ifndef _BURN_SOUND_H
+#define _BURN_SOUND_H
+
 #if defined BUILD_X86_ASM
 extern "C" {
 	int __cdecl ChannelMix_QS_A(int* Dest, int nLen,
@@ -30,9 +33,68 @@ void BurnSoundCopyClamp_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Add_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_Add_C(INT32* Src, INT16* Dest, INT32 Len);
+void BurnSoundCopyClamp_Stereo_C(INT32* SrcL, INT32* SrcR, INT16* Dest, INT32 Len);
+void BurnSoundCopyClamp_Stereo_Add_C(INT32* SrcL, INT32* SrcR, INT16* Dest, INT32 Len);
+
+// 32-bit mixing bus, so several chips can be summed and clamped to the output only once.
+// BurnSoundBusBegin() clears nLen samples, the chips add into pBurnSoundBus[0] (left) and
+// pBurnSoundBus[1] (right) with 8 bits of fraction, and BurnSoundBusFlush() writes the
+// clamped result to pDest (or adds it to pDest if bAdd is set).
+extern INT32* pBurnSoundBus[2];
+void BurnSoundBusBegin(INT32 nLen);
+void BurnSoundBusAdd(INT16* pSrc, INT32 nLen);		// add an INT16 stereo buffer
+void BurnSoundBusFlush(INT16* pDest, INT32 nLen, INT32 bAdd);
+void BurnSoundBusExit(); // called in burn.cpp: BurnDrvExit()
 
 extern INT32 cmc_4p_Precalc();
 
+// Mixing and resampling of the outputs of a sound chip (see snd/burn_ym2151.cpp for usage).
+// An input is a mono buffer (or the sum of up to 3 buffers) with a gain for each side, so the
+// volumes and routes of a chip are applied as a gain matrix instead of being tested per sample.
+struct BurnSoundInput {
+	INT16* pBuffer[3];
+	INT32 nBuffers;
+	double dGain[2];		// left and right, 0.0 when not routed to that side
+};
+
+#define BURN_SND_MIX_REPLACE		0
+#define BURN_SND_MIX_ADD			1	// add and clip
+#define BURN_SND_MIX_ADD_NOCLIP		2	// add, wrapping on overflow
+
+void BurnSoundInputSet(BurnSoundInput* pInput, INT16* pBuffer, double dVolume, INT32 nRouteDir);
+void BurnSoundInputSetLR(BurnSoundInput* pInput, INT16* pBuffer, double dLeftVolume, double dRightVolume);
+void BurnSoundInputAddBuffer(BurnSoundInput* pInput, INT16* pBuffer);		// the buffers of an input are summed before the gain
+
+// Stereo samples nStart to nEnd - 1 of pDest from samples nStart to nEnd - 1 of the inputs
+void BurnSoundMix(INT16* pDest, INT32 nStart, INT32 nEnd, const BurnSoundInput* pInputs, INT32 nInputs, INT32 nMode);
+// Stereo samples nStart to nEnd - 1 of pDest with 4-point interpolation. nPosition is the 16.16 position
+// of the newest tap in the inputs, it's advanced by nStep per sample and returned.
+UINT32 BurnSoundResample(INT16* pDest, INT32 nStart, INT32 nEnd, const BurnSoundInput* pInputs, INT32 nInputs, UINT32 nPosition, UINT32 nStep, INT32 nMode);
+
+// Sound chip commands replayed on a thread of their own (see snd/burn_ym2610.cpp for usage). The emulation
+// thread pushes the register writes of a chip with the position (in chip samples) they happen at, and
+// the worker renders up to that position and makes the write, so the output is the same as rendering on
+// the emulation thread. Anything else that reads or changes the chip state on the emulation thread has to
+// call BurnSoundQueueSync() first.
+struct BurnSoundQueue;
+BurnSoundQueue* BurnSoundQueueInit(void (*pReplay)(INT32 nPosition, INT32 nCommand, INT32 nData));	// NULL: render on the emulation thread
+void BurnSoundQueueExit(BurnSoundQueue* pQueue);
+void BurnSoundQueuePush(BurnSoundQueue* pQueue, INT32 nPosition, INT32 nCommand, INT32 nData);
+void BurnSoundQueueSync(BurnSoundQueue* pQueue);		// returns once the worker has replayed every command pushed
+void BurnSoundQueueSyncAll(); // called in burn.cpp: BurnAreaScan()
+
+// Sound chip profiler, on when bBurnSoundProfile is set at BurnDrvInit(). The render entry points of the
+// chips time themselves, either in the function with BurnSoundProfileStart() and BurnSoundProfileStop(),
+// or, for the ones called through a function pointer, by replacing the pointer after init with
+// BurnSoundProfileWrap(). The times are inclusive, and a report is printed at BurnDrvExit().
+typedef void (*BurnSoundRenderFn)(INT16* pSoundBuf, INT32 nLength);
+UINT64 BurnSoundProfileStart();		// 0 when the profiler is off
+void BurnSoundProfileStop(const TCHAR* szName, UINT64 nStart);
+BurnSoundRenderFn BurnSoundProfileWrap(const TCHAR* szName, BurnSoundRenderFn pRender);	// pRender when the profiler is off
+void BurnSoundProfileInit(); // called in burn.cpp: BurnDrvInit()
+void BurnSoundProfileFrame(UINT64 nStart); // called in burn.cpp: BurnDrvFrame()
+void BurnSoundProfileExit(); // called in burn.cpp: BurnDrvExit()
+
 void BurnSoundDCFilter();
 void BurnSoundDCFilterReset(); // called in burn.cpp: BurnDrvInit()
 
@@ -51,3 +113,5 @@ extern "C" INT16 Precalc[];
 #define INTERPOLATE4PU_8BIT(fp, sN, s0, s1, s2)      (((UINT32)((sN) * Precalc[(INT32)(fp) * 4 + 0]) + (UINT32)((s0) * Precalc[(INT32)(fp) * 4 + 1]) + (UINT32)((s1) * Precalc[(INT32)(fp) * 4 + 2]) + (UINT32)((s2) * Precalc[(INT32)(fp) * 4 + 3])) / 64)
 #define INTERPOLATE4PU_16BIT(fp, sN, s0, s1, s2)     (((UINT32)((sN) * Precalc[(INT32)(fp) * 4 + 0]) + (UINT32)((s0) * Precalc[(INT32)(fp) * 4 + 1]) + (UINT32)((s1) * Precalc[(INT32)(fp) * 4 + 2]) + (UINT32)((s2) * Precalc[(INT32)(fp) * 4 + 3])) / 16384)
 #define INTERPOLATE4PU_CUSTOM(fp, sN, s0, s1, s2, v) (((UINT32)((sN) * Precalc[(INT32)(fp) * 4 + 0]) + (UINT32)((s0) * Precalc[(INT32)(fp) * 4 + 1]) + (UINT32)((s1) * Precalc[(INT32)(fp) * 4 + 2]) + (UINT32)((s2) * Precalc[(INT32)(fp) * 4 + 3])) / (UINT32)(v))
+
+#endif
@@ -3,9 +3,59 @@
 
 #define CLIP(A) ((A) < -0x8000 ? -0x8000 : (A) > 0x7fff ? 0x7fff : (A))
 
+// The saturating packs of SSE2/AVX2 (packs_epi32) and NEON (vqmovn_s32) clamp exactly like CLIP,
+// so the vector loops below give the same output as the plain C tails.
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_SOUND_COPY_SSE2
+ #include <emmintrin.h>
+ #if defined (__AVX2__)
+  #define BURN_SOUND_COPY_AVX2
+  #include <immintrin.h>
+ #endif
+#endif
+
+#if defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_SOUND_COPY_NEON
+ #include <arm_neon.h>
+#endif
+
+#if defined BURN_SOUND_COPY_SSE2
+// the 8 INT16 of pDest sign extended to 2 x 4 INT32
+static inline void BurnSoundLoad16_SSE2(INT16* pDest, __m128i* pLow, __m128i* pHigh)
+{
+	__m128i d = _mm_loadu_si128((__m128i*)pDest);
+
+	*pLow = _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16);
+	*pHigh = _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16);
+}
+#endif
+
 void BurnSoundCopyClamp_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
 	Len *= 2;
+
+#if defined BURN_SOUND_COPY_AVX2
+	for (; Len >= 16; Len -= 16, Src += 16, Dest += 16) {
+		__m256i a = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + 0)), 8);
+		__m256i b = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)(Src + 8)), 8);
+		_mm256_storeu_si256((__m256i*)Dest, _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8));
+	}
+#endif
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 0)), 8);
+		__m128i b = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 4)), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(a, b));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		int16x4_t a = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + 0), 8));
+		int16x4_t b = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src + 4), 8));
+		vst1q_s16(Dest, vcombine_s16(a, b));
+	}
+#endif
+
 	while (Len--) {
 		*Dest = CLIP((*Src >> 8));
 		Src++;
@@ -16,7 +66,24 @@ void BurnSoundCopyClamp_C(INT32 *Src, INT16 *Dest, INT32 Len)
 void BurnSoundCopyClamp_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
 	Len *= 2;
-		while (Len--) {
+
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		__m128i dl, dh;
+		BurnSoundLoad16_SSE2(Dest, &dl, &dh);
+		__m128i a = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 0)), 8), dl);
+		__m128i b = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 4)), 8), dh);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(a, b));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		int16x4_t a = vqmovn_s32(vaddw_s16(vshrq_n_s32(vld1q_s32(Src + 0), 8), vld1_s16(Dest + 0)));
+		int16x4_t b = vqmovn_s32(vaddw_s16(vshrq_n_s32(vld1q_s32(Src + 4), 8), vld1_s16(Dest + 4)));
+		vst1q_s16(Dest, vcombine_s16(a, b));
+	}
+#endif
+
+	while (Len--) {
 		*Dest = CLIP((*Src >> 8) + *Dest);
 		Src++;
 		Dest++;
@@ -25,6 +92,26 @@ void BurnSoundCopyClamp_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 
 void BurnSoundCopyClamp_Mono_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
+#if defined BURN_SOUND_COPY_AVX2
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 16) {
+		__m256i a = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)Src), 8);
+		// the unpacks and the pack all work inside 128-bit lanes, so the samples come out in order
+		_mm256_storeu_si256((__m256i*)Dest, _mm256_packs_epi32(_mm256_unpacklo_epi32(a, a), _mm256_unpackhi_epi32(a, a)));
+	}
+#endif
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)Src), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(_mm_unpacklo_epi32(a, a), _mm_unpackhi_epi32(a, a)));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		int16x4x2_t s;
+		s.val[0] = s.val[1] = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src), 8));
+		vst2_s16(Dest, s);
+	}
+#endif
+
 	while (Len--) {
 		Dest[0] = CLIP((*Src >> 8));
 		Dest[1] = CLIP((*Src >> 8));
@@ -35,6 +122,23 @@ void BurnSoundCopyClamp_Mono_C(INT32 *Src, INT16 *Dest, INT32 Len)
 
 void BurnSoundCopyClamp_Mono_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		__m128i dl, dh;
+		BurnSoundLoad16_SSE2(Dest, &dl, &dh);
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)Src), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(_mm_add_epi32(_mm_unpacklo_epi32(a, a), dl), _mm_add_epi32(_mm_unpackhi_epi32(a, a), dh)));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		int32x4_t a = vshrq_n_s32(vld1q_s32(Src), 8);
+		int16x4x2_t d = vld2_s16(Dest);
+		d.val[0] = vqmovn_s32(vaddw_s16(a, d.val[0]));
+		d.val[1] = vqmovn_s32(vaddw_s16(a, d.val[1]));
+		vst2_s16(Dest, d);
+	}
+#endif
+
 	while (Len--) {
 		Dest[0] = CLIP((*Src >> 8) + Dest[0]);
 		Dest[1] = CLIP((*Src >> 8) + Dest[1]);
@@ -43,4 +147,65 @@ void BurnSoundCopyClamp_Mono_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 	}
 }
 
+void BurnSoundCopyClamp_Stereo_C(INT32 *SrcL, INT32 *SrcR, INT16 *Dest, INT32 Len)
+{
+#if defined BURN_SOUND_COPY_AVX2
+	for (; Len >= 8; Len -= 8, SrcL += 8, SrcR += 8, Dest += 16) {
+		__m256i l = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)SrcL), 8);
+		__m256i r = _mm256_srai_epi32(_mm256_loadu_si256((__m256i*)SrcR), 8);
+		_mm256_storeu_si256((__m256i*)Dest, _mm256_packs_epi32(_mm256_unpacklo_epi32(l, r), _mm256_unpackhi_epi32(l, r)));
+	}
+#endif
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 4; Len -= 4, SrcL += 4, SrcR += 4, Dest += 8) {
+		__m128i l = _mm_srai_epi32(_mm_loadu_si128((__m128i*)SrcL), 8);
+		__m128i r = _mm_srai_epi32(_mm_loadu_si128((__m128i*)SrcR), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r)));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 4; Len -= 4, SrcL += 4, SrcR += 4, Dest += 8) {
+		int16x4x2_t s;
+		s.val[0] = vqmovn_s32(vshrq_n_s32(vld1q_s32(SrcL), 8));
+		s.val[1] = vqmovn_s32(vshrq_n_s32(vld1q_s32(SrcR), 8));
+		vst2_s16(Dest, s);
+	}
+#endif
+
+	while (Len--) {
+		Dest[0] = CLIP((*SrcL >> 8));
+		Dest[1] = CLIP((*SrcR >> 8));
+		SrcL++;
+		SrcR++;
+		Dest += 2;
+	}
+}
+
+void BurnSoundCopyClamp_Stereo_Add_C(INT32 *SrcL, INT32 *SrcR, INT16 *Dest, INT32 Len)
+{
+#if defined BURN_SOUND_COPY_SSE2
+	for (; Len >= 4; Len -= 4, SrcL += 4, SrcR += 4, Dest += 8) {
+		__m128i dl, dh;
+		BurnSoundLoad16_SSE2(Dest, &dl, &dh);
+		__m128i l = _mm_srai_epi32(_mm_loadu_si128((__m128i*)SrcL), 8);
+		__m128i r = _mm_srai_epi32(_mm_loadu_si128((__m128i*)SrcR), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(_mm_add_epi32(_mm_unpacklo_epi32(l, r), dl), _mm_add_epi32(_mm_unpackhi_epi32(l, r), dh)));
+	}
+#elif defined BURN_SOUND_COPY_NEON
+	for (; Len >= 4; Len -= 4, SrcL += 4, SrcR += 4, Dest += 8) {
+		int16x4x2_t d = vld2_s16(Dest);
+		d.val[0] = vqmovn_s32(vaddw_s16(vshrq_n_s32(vld1q_s32(SrcL), 8), d.val[0]));
+		d.val[1] = vqmovn_s32(vaddw_s16(vshrq_n_s32(vld1q_s32(SrcR), 8), d.val[1]));
+		vst2_s16(Dest, d);
+	}
+#endif
+
+	while (Len--) {
+		Dest[0] = CLIP((*SrcL >> 8) + Dest[0]);
+		Dest[1] = CLIP((*SrcR >> 8) + Dest[1]);
+		SrcL++;
+		SrcR++;
+		Dest += 2;
+	}
+}
+
 #undef CLIP
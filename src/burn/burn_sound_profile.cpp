@@ -0,0 +1,175 @@
+// Sound chip profiler (see burn_sound.h)
+#include "burnint.h"
+#include "burn_sound.h"
+
+bool bBurnSoundProfile = false;
+
+// The time stamp counter where there is one, else clock() (coarse, but the shares of the frame still add up)
+#if (defined __GNUC__ && (defined __i386__ || defined __x86_64__))
+ #include <x86intrin.h>
+ #define PROFILE_TICKS()	((UINT64)__rdtsc())
+ #define PROFILE_UNIT		"cycles"
+#elif (defined _MSC_VER && (defined _M_IX86 || defined _M_X64))
+ #include <intrin.h>
+ #define PROFILE_TICKS()	((UINT64)__rdtsc())
+ #define PROFILE_UNIT		"cycles"
+#else
+ #include <time.h>
+ #define PROFILE_TICKS()	((UINT64)clock())
+ #define PROFILE_UNIT		"clock ticks"
+#endif
+
+#define PROFILE_MAX			32			// chips
+#define PROFILE_WRAP_MAX	8			// render functions wrapped by BurnSoundProfileWrap()
+#define PROFILE_BUCKETS		7
+
+// Upper limits of the histogram buckets, in % of the frame time
+static const INT32 nBucketLimit[PROFILE_BUCKETS] = { 1, 2, 5, 10, 20, 50, 0x7fffffff };
+
+struct SoundProfile {
+	const TCHAR* szName;
+	UINT64 nFrameTicks;					// this frame
+	UINT64 nTotalTicks;
+	UINT64 nCalls;
+	double dMaxShare;
+	UINT32 nBuckets[PROFILE_BUCKETS];
+};
+
+static bool bProfileActive = false;
+static SoundProfile Profiles[PROFILE_MAX];
+static INT32 nProfiles = 0;
+static UINT64 nProfileFrames = 0;
+static UINT64 nProfileFrameTicks = 0;
+
+static SoundProfile* ProfileFind(const TCHAR* szName)
+{
+	for (INT32 i = 0; i < nProfiles; i++) {
+		if (Profiles[i].szName == szName || _tcsicmp(Profiles[i].szName, szName) == 0) {
+			return &Profiles[i];
+		}
+	}
+
+	if (nProfiles == PROFILE_MAX) {
+		return NULL;
+	}
+
+	SoundProfile* pProfile = &Profiles[nProfiles++];
+	memset(pProfile, 0, sizeof(SoundProfile));
+	pProfile->szName = szName;
+
+	return pProfile;
+}
+
+UINT64 BurnSoundProfileStart()
+{
+	return bProfileActive ? PROFILE_TICKS() : 0;
+}
+
+void BurnSoundProfileStop(const TCHAR* szName, UINT64 nStart)
+{
+	if (!bProfileActive) {
+		return;
+	}
+
+	UINT64 nTicks = PROFILE_TICKS() - nStart;
+
+	SoundProfile* pProfile = ProfileFind(szName);
+	if (pProfile) {
+		pProfile->nFrameTicks += nTicks;
+		pProfile->nCalls++;
+	}
+}
+
+// A trampoline for each wrapped render function, which times the call of the function it replaced
+static const TCHAR* szWrapName[PROFILE_WRAP_MAX];
+static BurnSoundRenderFn pWrapRender[PROFILE_WRAP_MAX];
+static INT32 nWraps = 0;
+
+template <INT32 n>
+static void ProfileWrap(INT16* pSoundBuf, INT32 nLength)
+{
+	UINT64 nStart = PROFILE_TICKS();
+	pWrapRender[n](pSoundBuf, nLength);
+	BurnSoundProfileStop(szWrapName[n], nStart);
+}
+
+static const BurnSoundRenderFn pWrapTrampoline[PROFILE_WRAP_MAX] = {
+	ProfileWrap<0>, ProfileWrap<1>, ProfileWrap<2>, ProfileWrap<3>,
+	ProfileWrap<4>, ProfileWrap<5>, ProfileWrap<6>, ProfileWrap<7>
+};
+
+BurnSoundRenderFn BurnSoundProfileWrap(const TCHAR* szName, BurnSoundRenderFn pRender)
+{
+	if (!bProfileActive || pRender == NULL || nWraps == PROFILE_WRAP_MAX) {
+		return pRender;
+	}
+
+	szWrapName[nWraps] = szName;
+	pWrapRender[nWraps] = pRender;
+
+	return pWrapTrampoline[nWraps++];
+}
+
+void BurnSoundProfileInit()
+{
+	bProfileActive = bBurnSoundProfile;
+	nProfiles = 0;
+	nWraps = 0;
+	nProfileFrames = 0;
+	nProfileFrameTicks = 0;
+}
+
+void BurnSoundProfileFrame(UINT64 nStart)
+{
+	if (!bProfileActive) {
+		return;
+	}
+
+	UINT64 nFrameTicks = PROFILE_TICKS() - nStart;
+
+	nProfileFrames++;
+	nProfileFrameTicks += nFrameTicks;
+
+	for (INT32 i = 0; i < nProfiles; i++) {
+		SoundProfile* pProfile = &Profiles[i];
+		double dShare = nFrameTicks ? pProfile->nFrameTicks * 100.0 / nFrameTicks : 0.0;
+
+		INT32 nBucket = 0;
+		while (dShare >= nBucketLimit[nBucket]) {
+			nBucket++;
+		}
+		pProfile->nBuckets[nBucket]++;
+
+		if (dShare > pProfile->dMaxShare) {
+			pProfile->dMaxShare = dShare;
+		}
+
+		pProfile->nTotalTicks += pProfile->nFrameTicks;
+		pProfile->nFrameTicks = 0;
+	}
+}
+
+void BurnSoundProfileExit()
+{
+	if (!bProfileActive) {
+		return;
+	}
+	bProfileActive = false;
+
+	if (nProfileFrames == 0 || nProfileFrameTicks == 0) {
+		return;
+	}
+
+	bprintf(PRINT_IMPORTANT, _T("Sound profile: %u frames, %.0f ") _T(PROFILE_UNIT) _T(" per frame\n"), (UINT32)nProfileFrames, (double)nProfileFrameTicks / nProfileFrames);
+	bprintf(PRINT_IMPORTANT, _T("  chip        avg%%   max%%  calls/frame   frames by share of the frame: <1%% <2%% <5%% <10%% <20%% <50%% >=50%%\n"));
+
+	for (INT32 i = 0; i < nProfiles; i++) {
+		SoundProfile* pProfile = &Profiles[i];
+		UINT32* n = pProfile->nBuckets;
+
+		// a chip first timed after the first frame is missing from the histogram of the frames before that
+		bprintf(PRINT_IMPORTANT, _T("  %-10s %5.1f  %5.1f  %11.1f   %u %u %u %u %u %u %u\n"), pProfile->szName,
+			pProfile->nTotalTicks * 100.0 / nProfileFrameTicks, pProfile->dMaxShare, (double)pProfile->nCalls / nProfileFrames,
+			n[0], n[1], n[2], n[3], n[4], n[5], n[6]);
+	}
+}
@@ -0,0 +1,227 @@
+// Sound chip commands replayed on a thread of their own (see burn_sound.h)
+#include "burnint.h"
+#include "burn_sound.h"
+
+bool bBurnSoundThread = false;
+
+// The queue is a single producer, single consumer ring: only the emulation thread writes nWrite,
+// only the worker writes nRead. The indices and the sleeping/waiting flags are sequentially
+// consistent, which publishes a ring entry with its index, and each side sets its flag before
+// checking the other side's index once more, so a wake up can't be missed.
+// Without atomics for the compiler, BurnSoundQueueInit() always returns NULL.
+#if defined __GNUC__
+ #define QUEUE_SUPPORTED
+ #define QUEUE_LOAD(x)		__atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+ #define QUEUE_STORE(x, v)	__atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+#elif defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+ #include <emmintrin.h>
+ #define QUEUE_SUPPORTED
+ #define QUEUE_LOAD(x)		(x)
+ #define QUEUE_STORE(x, v)	{ (x) = (v); _ReadWriteBarrier(); _mm_mfence(); _ReadWriteBarrier(); }
+#else
+ #define QUEUE_LOAD(x)		(x)
+ #define QUEUE_STORE(x, v)	{ (x) = (v); }
+#endif
+
+#define QUEUE_SIZE			8192		// commands, a power of 2
+#define QUEUE_MAX			4			// queues (chips) at the same time
+
+// The worker is only woken once this many commands are pending or the position has moved this many
+// samples since the last wake up, so it isn't woken for every write
+#define QUEUE_WAKE_COMMANDS	32
+#define QUEUE_WAKE_SAMPLES	128
+
+struct BurnSoundQueueCommand {
+	INT32 nPosition;
+	INT32 nCommand;
+	INT32 nData;
+};
+
+struct BurnSoundQueue {
+	BurnSoundQueueCommand* pRing;
+	void (*pReplay)(INT32 nPosition, INT32 nCommand, INT32 nData);
+
+	volatile UINT32 nWrite;
+	volatile UINT32 nRead;
+	volatile INT32 bSleeping;				// the worker waits on pWake
+	volatile INT32 bWaiting;				// the emulation thread waits on pDone
+	volatile INT32 bQuit;
+
+	INT32 nWakePosition;
+
+	void* pWake;
+	void* pDone;
+	void* pThread;
+};
+
+static BurnSoundQueue* pQueues[QUEUE_MAX] = { NULL, };
+
+static void QueueWorker(void* pParam)
+{
+	BurnSoundQueue* pQueue = (BurnSoundQueue*)pParam;
+	UINT32 nRead = pQueue->nRead;
+
+	while (1) {
+		if (nRead == QUEUE_LOAD(pQueue->nWrite)) {
+			if (QUEUE_LOAD(pQueue->bQuit)) {
+				break;
+			}
+
+			QUEUE_STORE(pQueue->bSleeping, 1);
+			if (nRead == QUEUE_LOAD(pQueue->nWrite) && !QUEUE_LOAD(pQueue->bQuit)) {
+				BurnEventWait(pQueue->pWake);
+			}
+			QUEUE_STORE(pQueue->bSleeping, 0);
+			continue;
+		}
+
+		BurnSoundQueueCommand* pCommand = &pQueue->pRing[nRead & (QUEUE_SIZE - 1)];
+		pQueue->pReplay(pCommand->nPosition, pCommand->nCommand, pCommand->nData);
+
+		nRead++;
+		QUEUE_STORE(pQueue->nRead, nRead);
+
+		if (QUEUE_LOAD(pQueue->bWaiting)) {
+			QUEUE_STORE(pQueue->bWaiting, 0);
+			BurnEventSet(pQueue->pDone);
+		}
+	}
+}
+
+static void QueueWake(BurnSoundQueue* pQueue)
+{
+	if (QUEUE_LOAD(pQueue->bSleeping)) {
+		QUEUE_STORE(pQueue->bSleeping, 0);
+		BurnEventSet(pQueue->pWake);
+	}
+}
+
+// Returns when at most nPending commands are left
+static void QueueWait(BurnSoundQueue* pQueue, UINT32 nPending)
+{
+	while (pQueue->nWrite - QUEUE_LOAD(pQueue->nRead) > nPending) {
+		QUEUE_STORE(pQueue->bWaiting, 1);
+		if (pQueue->nWrite - QUEUE_LOAD(pQueue->nRead) <= nPending) {
+			break;
+		}
+
+		QueueWake(pQueue);
+		BurnEventWait(pQueue->pDone);
+	}
+}
+
+void BurnSoundQueuePush(BurnSoundQueue* pQueue, INT32 nPosition, INT32 nCommand, INT32 nData)
+{
+	if (pQueue->nWrite - QUEUE_LOAD(pQueue->nRead) >= QUEUE_SIZE) {
+		QueueWait(pQueue, QUEUE_SIZE - 1);
+	}
+
+	BurnSoundQueueCommand* pCommand = &pQueue->pRing[pQueue->nWrite & (QUEUE_SIZE - 1)];
+	pCommand->nPosition = nPosition;
+	pCommand->nCommand = nCommand;
+	pCommand->nData = nData;
+
+	QUEUE_STORE(pQueue->nWrite, pQueue->nWrite + 1);
+
+	if (QUEUE_LOAD(pQueue->bSleeping)) {
+		// the position goes back to 0 at the start of a frame
+		if (pQueue->nWrite - QUEUE_LOAD(pQueue->nRead) >= QUEUE_WAKE_COMMANDS || nPosition < pQueue->nWakePosition || nPosition - pQueue->nWakePosition >= QUEUE_WAKE_SAMPLES) {
+			pQueue->nWakePosition = nPosition;
+			QueueWake(pQueue);
+		}
+	}
+}
+
+void BurnSoundQueueSync(BurnSoundQueue* pQueue)
+{
+	QueueWait(pQueue, 0);
+}
+
+void BurnSoundQueueSyncAll()
+{
+	for (INT32 i = 0; i < QUEUE_MAX; i++) {
+		if (pQueues[i]) {
+			BurnSoundQueueSync(pQueues[i]);
+		}
+	}
+}
+
+static void QueueFree(BurnSoundQueue* pQueue)
+{
+	if (pQueue->pDone) {
+		BurnEventFree(pQueue->pDone);
+	}
+	if (pQueue->pWake) {
+		BurnEventFree(pQueue->pWake);
+	}
+	BurnFree(pQueue->pRing);
+	BurnFree(pQueue);
+}
+
+BurnSoundQueue* BurnSoundQueueInit(void (*pReplay)(INT32 nPosition, INT32 nCommand, INT32 nData))
+{
+#if defined QUEUE_SUPPORTED
+	if (!bBurnSoundThread || BurnThreadStart == NULL || BurnThreadJoin == NULL || BurnEventNew == NULL || BurnEventFree == NULL || BurnEventSet == NULL || BurnEventWait == NULL) {
+		return NULL;
+	}
+
+	INT32 nSlot = 0;
+	while (nSlot < QUEUE_MAX && pQueues[nSlot]) {
+		nSlot++;
+	}
+	if (nSlot == QUEUE_MAX) {
+		return NULL;
+	}
+
+	BurnSoundQueue* pQueue = (BurnSoundQueue*)BurnMalloc(sizeof(BurnSoundQueue));
+	if (pQueue == NULL) {
+		return NULL;
+	}
+	memset(pQueue, 0, sizeof(BurnSoundQueue));
+
+	pQueue->pReplay = pReplay;
+	pQueue->pRing = (BurnSoundQueueCommand*)BurnMalloc(QUEUE_SIZE * sizeof(BurnSoundQueueCommand));
+	pQueue->pWake = BurnEventNew();
+	pQueue->pDone = BurnEventNew();
+
+	if (pQueue->pRing == NULL || pQueue->pWake == NULL || pQueue->pDone == NULL) {
+		QueueFree(pQueue);
+		return NULL;
+	}
+
+	pQueue->pThread = BurnThreadStart(QueueWorker, pQueue);
+	if (pQueue->pThread == NULL) {
+		QueueFree(pQueue);
+		return NULL;
+	}
+
+	pQueues[nSlot] = pQueue;
+
+	return pQueue;
+#else
+	(void)pReplay;
+
+	return NULL;
+#endif
+}
+
+void BurnSoundQueueExit(BurnSoundQueue* pQueue)
+{
+	if (pQueue == NULL) {
+		return;
+	}
+
+	BurnSoundQueueSync(pQueue);
+
+	QUEUE_STORE(pQueue->bQuit, 1);
+	BurnEventSet(pQueue->pWake);
+	BurnThreadJoin(pQueue->pThread);
+
+	for (INT32 i = 0; i < QUEUE_MAX; i++) {
+		if (pQueues[i] == pQueue) {
+			pQueues[i] = NULL;
+		}
+	}
+
+	QueueFree(pQueue);
+}
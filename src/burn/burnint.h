@@ -141,10 +141,28 @@ struct cpu_core_config {
 
 	UINT64 nMemorySize;		// how large is our memory range?
 	UINT32 nAddressXor;		// fix endianness for some cpus
+
+	INT32 (*skip)();		// end the timeslice as if it was run, returns the cycles skipped (idle loops)
+	UINT32 (*state)();		// hash of the registers and flags, less the pc and refresh counters (idle loops)
 };
 
 void CpuCheatRegister(INT32 type, cpu_core_config *config);
 
+// burn_idle.cpp - idle loop detection, on when nBurnIdleMode is set at BurnDrvInit() and the driver isn't
+// on the deny list. A cpu core registers each cpu at init and, when it gets a slot back, reports the
+// instruction fetches and memory accesses of that cpu. A short loop that goes back to the same address
+// with the same reads, the same registers (cpu_core_config.state) and no writes for a few passes is taken
+// to wait for an interrupt, and the rest of the timeslice is skipped with cpu_core_config.skip. A report
+// is printed at BurnDrvExit().
+inline static UINT32 BurnIdleHash(UINT32 nHash, UINT32 nData) { return ((nHash << 5) | (nHash >> 27)) ^ (nData * 0x9e3779b9); }
+INT32 BurnIdleRegister(cpu_core_config *config, const char *szName, INT32 nCpu);	// -1 when detection is off
+void BurnIdleFetch(INT32 nSlot, UINT32 nPc);
+void BurnIdleRead(INT32 nSlot, UINT32 nAddress, UINT32 nData);
+void BurnIdleWrite(INT32 nSlot);
+void BurnIdleInit(); // called in burn.cpp: BurnDrvInit()
+void BurnIdleFrame(); // called in burn.cpp: BurnDrvFrame()
+void BurnIdleExit(); // called in burn.cpp: BurnDrvExit()
+
 // burn_memory.cpp
 void BurnInitMemoryManager();
 UINT8 *BurnMalloc(INT32 size);
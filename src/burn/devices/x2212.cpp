@@ -80,6 +80,11 @@ void x2212_init(INT32 num_chips)
 		}
 	}
 
+	// auto-store happens when the nvram is scanned
+	if (num_chips & X2212_AUTOSTORE) {
+		BurnAreaScanSetDynamic();
+	}
+
 	x2212_reset();
 }
 
@@ -2144,6 +2144,9 @@ INT32 Cps2Init()
 		return 1;
 	}
 
+	// The CPS2 scan only passes areas on ACB_READ, so serializing can use a cached list of them
+	BurnAreaScanSetStatic();
+
 	return CpsRunInit();
 }
 
@@ -4,6 +4,14 @@
 #include <stddef.h>
 #include "cps.h"
 
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_QSOUND_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_QSOUND_NEON
+ #include <arm_neon.h>
+#endif
+
 static const INT32 nQscClock = 4000000;
 static const INT32 nQscClockDivider = 166;
 
@@ -273,219 +281,343 @@ void QscWrite(INT32 a, INT32 d)
 	}
 }
 
-INT32 QscUpdate(INT32 nEnd)
+// Channels are rendered in spans: the number of samples a channel can play before it gets near its end
+// (where the end buffer and the loop come in) is worked out first, and that span is mixed without any checks.
+
+#if defined BURN_QSOUND_SSE2
+// The low 32 bits of a * b for each lane (SSE2 has no pmulld)
+static inline __m128i QscMul32_SSE2(__m128i a, __m128i b)
 {
-	INT32 nLen;
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
 
-	if (nEnd > nBurnSoundLen) {
-		nEnd = nBurnSoundLen;
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+}
+
+// a / (1 << n) for each lane, rounded towards 0 like the C division
+#define QSC_DIV_SSE2(a, n)	_mm_srai_epi32(_mm_add_epi32(a, _mm_and_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32((1 << (n)) - 1))), n)
+#endif
+
+#if defined BURN_QSOUND_NEON
+#define QSC_DIV_NEON(a, n)	vshrq_n_s32(vaddq_s32(a, vandq_s32(vshrq_n_s32(a, 31), vdupq_n_s32((1 << (n)) - 1))), n)
+#endif
+
+// Linear interpolation, n samples from nPos on, returns the new position
+static INT32 QscMixSpan_Linear(const INT8* pBank, INT32* pTemp, INT32 n, INT32 nChanPos, INT32 nAdvance, INT32 VolL, INT32 VolR)
+{
+#if defined BURN_QSOUND_SSE2
+	const __m128i vVol = _mm_setr_epi32(VolL, VolR, VolL, VolR);
+
+	for (; n >= 2; n -= 2, pTemp += 4) {
+		INT32 p0 = (nChanPos >> 12) & 0xFFFF, f0 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
+		INT32 p1 = (nChanPos >> 12) & 0xFFFF, f1 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
+
+		__m128i vS0 = _mm_setr_epi32(pBank[p0], pBank[p0], pBank[p1], pBank[p1]);
+		__m128i vS1 = _mm_setr_epi32(pBank[p0 + 1], pBank[p0 + 1], pBank[p1 + 1], pBank[p1 + 1]);
+
+		// the position fraction and the sample difference both fit in 16 bits, so pmaddwd gives their product
+		__m128i vD = _mm_madd_epi16(_mm_setr_epi32(f0, f0, f1, f1), _mm_sub_epi32(vS1, vS0));
+		__m128i vS = _mm_add_epi32(_mm_slli_epi32(vS0, 6), QSC_DIV_SSE2(vD, 6));
+
+		__m128i vOut = _mm_srai_epi32(QscMul32_SSE2(vS, vVol), 3);
+		_mm_storeu_si128((__m128i*)pTemp, _mm_add_epi32(_mm_loadu_si128((__m128i*)pTemp), vOut));
 	}
+#elif defined BURN_QSOUND_NEON
+	const INT32 nVol[4] = { VolL, VolR, VolL, VolR };
+	const int32x4_t vVol = vld1q_s32(nVol);
 
-	nLen = nEnd - nPos;
+	for (; n >= 2; n -= 2, pTemp += 4) {
+		INT32 p0 = (nChanPos >> 12) & 0xFFFF, f0 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
+		INT32 p1 = (nChanPos >> 12) & 0xFFFF, f1 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
 
-	if (nLen <= 0) {
-		return 0;
+		const INT32 nS0[4] = { pBank[p0], pBank[p0], pBank[p1], pBank[p1] };
+		const INT32 nS1[4] = { pBank[p0 + 1], pBank[p0 + 1], pBank[p1 + 1], pBank[p1 + 1] };
+		const INT32 nF[4] = { f0, f0, f1, f1 };
+		int32x4_t vS0 = vld1q_s32(nS0);
+
+		int32x4_t vD = vmulq_s32(vld1q_s32(nF), vsubq_s32(vld1q_s32(nS1), vS0));
+		int32x4_t vS = vaddq_s32(vshlq_n_s32(vS0, 6), QSC_DIV_NEON(vD, 6));
+
+		vst1q_s32(pTemp, vaddq_s32(vld1q_s32(pTemp), vshrq_n_s32(vmulq_s32(vS, vVol), 3)));
 	}
+#endif
 
-	if (Tams < nLen) {
-		BurnFree(Qs_s);
-		Tams = nLen;
-		Qs_s = (INT32*)BurnMalloc(sizeof(INT32) * 2 * Tams);
+	for (; n > 0; n--, pTemp += 2) {
+		INT32 p = (nChanPos >> 12) & 0xFFFF;
+		INT32 s = pBank[p] * (1 << 6) + (nChanPos & ((1 << 12) - 1)) * (pBank[p + 1] - pBank[p]) / (1 << 6);
+
+		pTemp[0] += (s * VolL) >> 3;
+		pTemp[1] += (s * VolR) >> 3;
+
+		nChanPos += nAdvance;
 	}
 
-	memset(Qs_s, 0, nLen * 2 * sizeof(INT32));
+	return nChanPos;
+}
 
-	if (nInterpolation < 3) {
+// 4-point interpolation, n samples from nChanPos on, returns the new position
+static INT32 QscMixSpan_Cubic(const INT8* pBank, INT32* pTemp, INT32 n, INT32 nChanPos, INT32 nAdvance, INT32 VolL, INT32 VolR)
+{
+#if defined BURN_QSOUND_SSE2
+	// the interpolated samples are within +/-0x3000 and the volumes below 0x2000, so pmaddwd can scale them
+	if (VolL >= 0 && VolL < 0x8000 && VolR >= 0 && VolR < 0x8000) {
+		const __m128i vVol = _mm_setr_epi32(VolL, VolR, VolL, VolR);
+
+		for (; n >= 2; n -= 2, pTemp += 4) {
+			INT32 p0 = (nChanPos >> 12) & 0xFFFF, f0 = nChanPos & 0x0FFF;
+			nChanPos += nAdvance;
+			INT32 p1 = (nChanPos >> 12) & 0xFFFF, f1 = nChanPos & 0x0FFF;
+			nChanPos += nAdvance;
+
+			INT32 t0, t1;
+			memcpy(&t0, pBank + p0, 4);
+			memcpy(&t1, pBank + p1, 4);
+
+			// the 4 taps of both samples as 16 bit, times their Precalc factors
+			__m128i vT = _mm_unpacklo_epi32(_mm_cvtsi32_si128(t0), _mm_cvtsi32_si128(t1));
+			vT = _mm_srai_epi16(_mm_unpacklo_epi8(vT, vT), 8);
+			__m128i vC = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(Precalc + f0 * 4)), _mm_loadl_epi64((const __m128i*)(Precalc + f1 * 4)));
+
+			__m128i vM = _mm_madd_epi16(vT, vC);
+			__m128i vS = QSC_DIV_SSE2(_mm_add_epi32(vM, _mm_shuffle_epi32(vM, 0xb1)), 8);
+
+			_mm_storeu_si128((__m128i*)pTemp, _mm_add_epi32(_mm_loadu_si128((__m128i*)pTemp), _mm_madd_epi16(vS, vVol)));
+		}
+	}
+#elif defined BURN_QSOUND_NEON
+	const INT32 nVol[4] = { VolL, VolR, VolL, VolR };
+	const int32x4_t vVol = vld1q_s32(nVol);
+
+	for (; n >= 2; n -= 2, pTemp += 4) {
+		INT32 p0 = (nChanPos >> 12) & 0xFFFF, f0 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
+		INT32 p1 = (nChanPos >> 12) & 0xFFFF, f1 = nChanPos & 0x0FFF;
+		nChanPos += nAdvance;
+
+		INT8 nTaps[16] = { 0 };
+		memcpy(nTaps + 0, pBank + p0, 4);
+		memcpy(nTaps + 8, pBank + p1, 4);
+
+		int32x4_t vA = vmull_s16(vget_low_s16(vmovl_s8(vld1_s8(nTaps + 0))), vld1_s16(Precalc + f0 * 4));
+		int32x4_t vB = vmull_s16(vget_low_s16(vmovl_s8(vld1_s8(nTaps + 8))), vld1_s16(Precalc + f1 * 4));
+		int32x2_t vSum = vpadd_s32(vpadd_s32(vget_low_s32(vA), vget_high_s32(vA)), vpadd_s32(vget_low_s32(vB), vget_high_s32(vB)));
+		int32x4_t vS = QSC_DIV_NEON(vcombine_s32(vdup_lane_s32(vSum, 0), vdup_lane_s32(vSum, 1)), 8);
+
+		vst1q_s32(pTemp, vaddq_s32(vld1q_s32(pTemp), vmulq_s32(vS, vVol)));
+	}
+#endif
 
-		// Go through all channels
-		for (INT32 c = 0; c < 16; c++) {
+	for (; n > 0; n--, pTemp += 2) {
+		INT32 p = (nChanPos >> 12) & 0xFFFF;
+		INT32 s = INTERPOLATE4PS_CUSTOM(nChanPos & ((1 << 12) - 1), pBank[p + 0], pBank[p + 1], pBank[p + 2], pBank[p + 3], 256);
 
-			// If the channel is playing, add the samples to the buffer
-			if (QChan[c].bKey) {
-				INT32 VolL = (QChan[c].nMasterVolume * QChan[c].nVolume[0]) >> 8;
-				INT32 VolR = (QChan[c].nMasterVolume * QChan[c].nVolume[1]) >> 8;
-				INT32* pTemp = Qs_s;
-				INT32 i = nLen;
-				INT32 s, p;
+		pTemp[0] += s * VolL;
+		pTemp[1] += s * VolR;
 
-				if (QChan[c].bKey & 2) {
-					QChan[c].bKey &= ~2;
-					QChan[c].nPos = QChan[c].nPlayStart;
-				}
+		nChanPos += nAdvance;
+	}
 
-				while (i--) {
-
-					p = (QChan[c].nPos >> 12) & 0xFFFF;
-
-					// Check for end of sample
-					if (QChan[c].nPos >= (QChan[c].nEnd - 0x01000)) {
-						if (QChan[c].nLoop) {						// Loop sample
-							if (QChan[c].nPos < QChan[c].nEnd) {
-								QChan[c].nEndBuffer[0] = QChan[c].PlayBank[(QChan[c].nEnd - QChan[c].nLoop) >> 12];
-							} else {
-								QChan[c].nPos = QChan[c].nEnd - QChan[c].nLoop + (QChan[c].nPos & 0x0FFF);
-								p = (QChan[c].nPos >> 12) & 0xFFFF;
-							}
-						} else {
-							if (QChan[c].nPos < QChan[c].nEnd) {
-								QChan[c].nEndBuffer[0] = QChan[c].PlayBank[p];
-							} else {
-								QChan[c].bKey = 0;					// Quit playing
-								break;
-							}
-						}
-					} else {
-						QChan[c].nEndBuffer[0] = QChan[c].PlayBank[p + 1];
-					}
+	return nChanPos;
+}
 
-					// Interpolate sample
-					s = QChan[c].PlayBank[p] * (1 << 6) + ((QChan[c].nPos) & ((1 << 12) - 1)) * (QChan[c].nEndBuffer[0] - QChan[c].PlayBank[p]) / (1 << 6);
+// Samples until nChanPos reaches nLimit, at most n
+static inline INT32 QscSpanLength(INT32 nChanPos, INT32 nLimit, INT32 nAdvance, INT32 n)
+{
+	if (nChanPos >= nLimit) return 0;
+	if (nAdvance <= 0) return n;
 
-					// Add to the sound currently in the buffer
-					pTemp[0] += (s * VolL) >> 3;
-					pTemp[1] += (s * VolR) >> 3;
+	INT32 nSpan = (nLimit - nChanPos + nAdvance - 1) / nAdvance;
 
-					pTemp += 2;
+	return (nSpan < n) ? nSpan : n;
+}
 
-					QChan[c].nPos += QChan[c].nAdvance;				// increment sample position based on pitch
-				}
-			}
+static void QscRenderChannel_Linear(struct QChan_s* pc, INT32* pTemp, INT32 nLen)
+{
+	INT32 VolL = (pc->nMasterVolume * pc->nVolume[0]) >> 8;
+	INT32 VolR = (pc->nMasterVolume * pc->nVolume[1]) >> 8;
+	INT32 i = nLen;
+	INT32 s, p;
+
+	if (pc->bKey & 2) {
+		pc->bKey &= ~2;
+		pc->nPos = pc->nPlayStart;
+	}
+
+	while (i > 0) {
+		INT32 n = QscSpanLength(pc->nPos, pc->nEnd - 0x01000, pc->nAdvance, i);
+
+		if (n) {
+			pc->nPos = QscMixSpan_Linear(pc->PlayBank, pTemp, n, pc->nPos, pc->nAdvance, VolL, VolR);
+			pc->nEndBuffer[0] = pc->PlayBank[(((pc->nPos - pc->nAdvance) >> 12) & 0xFFFF) + 1];
+
+			pTemp += n * 2;
+			i -= n;
+			continue;
 		}
 
-		INT16 *pDest = pBurnSoundOut + (nPos << 1);
-		INT32 *pSrc = Qs_s;
-		for (INT32 i = 0; i < nLen; i++) {
-			INT32 nLeftSample = 0, nRightSample = 0;
-			
-			if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
-			}
-			if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
-			}
-			
-			if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
+		// The end of the sample, one sample at a time
+		p = (pc->nPos >> 12) & 0xFFFF;
+
+		if (pc->nLoop) {						// Loop sample
+			if (pc->nPos < pc->nEnd) {
+				pc->nEndBuffer[0] = pc->PlayBank[(pc->nEnd - pc->nLoop) >> 12];
+			} else {
+				pc->nPos = pc->nEnd - pc->nLoop + (pc->nPos & 0x0FFF);
+				p = (pc->nPos >> 12) & 0xFFFF;
 			}
-			if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
+		} else {
+			if (pc->nPos < pc->nEnd) {
+				pc->nEndBuffer[0] = pc->PlayBank[p];
+			} else {
+				pc->bKey = 0;					// Quit playing
+				break;
 			}
-			
-			pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
-			pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
 		}
-		nPos = nEnd;
 
-		return 0;
+		// Interpolate sample
+		s = pc->PlayBank[p] * (1 << 6) + ((pc->nPos) & ((1 << 12) - 1)) * (pc->nEndBuffer[0] - pc->PlayBank[p]) / (1 << 6);
+
+		// Add to the sound currently in the buffer
+		pTemp[0] += (s * VolL) >> 3;
+		pTemp[1] += (s * VolR) >> 3;
+
+		pTemp += 2;
+
+		pc->nPos += pc->nAdvance;				// increment sample position based on pitch
+		i--;
 	}
+}
 
-	// Go through all channels
-	for (INT32 c = 0; c < 16; c++) {
+static void QscRenderChannel_Cubic(struct QChan_s* pc, INT32* pTemp, INT32 nLen)
+{
+	INT32 VolL = (pc->nMasterVolume * pc->nVolume[0]) >> 11;
+	INT32 VolR = (pc->nMasterVolume * pc->nVolume[1]) >> 11;
+	INT32 i = nLen;
 
-		// If the channel is playing, add the samples to the buffer
-		if (QChan[c].bKey) {
-			INT32 VolL = (QChan[c].nMasterVolume * QChan[c].nVolume[0]) >> 11;
-			INT32 VolR = (QChan[c].nMasterVolume * QChan[c].nVolume[1]) >> 11;
-			INT32* pTemp = Qs_s;
-			INT32 i = nLen;
-
-			// handle 1st sample
-			if (QChan[c].bKey & 2) {
-				while (QChan[c].nPos < 0x1000 && i) {
-					INT32 p = QChan[c].nPlayStart >> 12;
-					INT32 s = INTERPOLATE4PS_CUSTOM(QChan[c].nPos,
-												  0,
-												  QChan[c].PlayBank[p + 0],
-												  QChan[c].PlayBank[p + 1],
-												  QChan[c].PlayBank[p + 2],
-												  256);
-
-					pTemp[0] += s * VolL;
-					pTemp[1] += s * VolR;
-
-					QChan[c].nPos += QChan[c].nAdvance;				// increment sample position based on pitch
-
-					pTemp += 2;
-					i--;
-				}
-				if (i > 0) {
-					QChan[c].bKey &= ~2;
-					QChan[c].nPos = (QChan[c].nPos & 0x0FFF) + QChan[c].nPlayStart;
+	// handle 1st sample
+	if (pc->bKey & 2) {
+		while (pc->nPos < 0x1000 && i) {
+			INT32 p = pc->nPlayStart >> 12;
+			INT32 s = INTERPOLATE4PS_CUSTOM(pc->nPos, 0, pc->PlayBank[p + 0], pc->PlayBank[p + 1], pc->PlayBank[p + 2], 256);
+
+			pTemp[0] += s * VolL;
+			pTemp[1] += s * VolR;
+
+			pc->nPos += pc->nAdvance;				// increment sample position based on pitch
+
+			pTemp += 2;
+			i--;
+		}
+		if (i > 0) {
+			pc->bKey &= ~2;
+			pc->nPos = (pc->nPos & 0x0FFF) + pc->nPlayStart;
+		}
+	}
+
+	while (i > 0) {
+		INT32 n = QscSpanLength(pc->nPos, pc->nEnd - 0x3000, pc->nAdvance, i);
+
+		if (n) {
+			pc->nPos = QscMixSpan_Cubic(pc->PlayBank, pTemp, n, pc->nPos, pc->nAdvance, VolL, VolR);
+
+			pTemp += n * 2;
+			i -= n;
+			continue;
+		}
+
+		// The end of the sample, one sample at a time
+		INT32 s;
+
+		if (pc->nPos < pc->nEnd) {
+			INT32 nIndex = 4 - ((pc->nEnd - pc->nPos) >> 12);
+			s = INTERPOLATE4PS_CUSTOM((pc->nPos) & ((1 << 12) - 1), pc->nEndBuffer[nIndex + 0], pc->nEndBuffer[nIndex + 1], pc->nEndBuffer[nIndex + 2], pc->nEndBuffer[nIndex + 3], 256);
+		} else {
+			if (pc->nLoop) {					// Loop sample
+				if (pc->nLoop <= 0x1000) {		// Don't play, but leave bKey on
+					pc->nPos = pc->nEnd - 0x1000;
+					break;
 				}
+				pc->nPos -= pc->nLoop;
+				continue;
+			} else {
+				pc->bKey = 0;					// Stop playing
+				break;
 			}
+		}
 
-			while (i > 0) {
-				INT32 s, p;
-
-				// Check for end of sample
-				if (QChan[c].nPos >= (QChan[c].nEnd - 0x3000)) {
-					if (QChan[c].nPos < QChan[c].nEnd) {
-						INT32 nIndex = 4 - ((QChan[c].nEnd - QChan[c].nPos) >> 12);
-						s = INTERPOLATE4PS_CUSTOM((QChan[c].nPos) & ((1 << 12) - 1),
-												  QChan[c].nEndBuffer[nIndex + 0],
-												  QChan[c].nEndBuffer[nIndex + 1],
-												  QChan[c].nEndBuffer[nIndex + 2],
-												  QChan[c].nEndBuffer[nIndex + 3],
-												  256);
-					} else {
-						if (QChan[c].nLoop) {					// Loop sample
-							if (QChan[c].nLoop <= 0x1000) {		// Don't play, but leave bKey on
-								QChan[c].nPos = QChan[c].nEnd - 0x1000;
-								break;
-							}
-							QChan[c].nPos -= QChan[c].nLoop;
-							continue;
-						} else {
-							QChan[c].bKey = 0;					// Stop playing
-							break;
-						}
-					}
-				} else {
-					p = (QChan[c].nPos >> 12) & 0xFFFF;
-					s = INTERPOLATE4PS_CUSTOM((QChan[c].nPos) & ((1 << 12) - 1),
-											  QChan[c].PlayBank[p + 0],
-											  QChan[c].PlayBank[p + 1],
-											  QChan[c].PlayBank[p + 2],
-											  QChan[c].PlayBank[p + 3],
-											  256);
-				}
+		// Add to the sound currently in the buffer
+		pTemp[0] += s * VolL;
+		pTemp[1] += s * VolR;
 
-				// Add to the sound currently in the buffer
-				pTemp[0] += s * VolL;
-				pTemp[1] += s * VolR;
+		pTemp += 2;
 
-				pTemp += 2;
+		pc->nPos += pc->nAdvance;				// increment sample position based on pitch
 
-				QChan[c].nPos += QChan[c].nAdvance;				// increment sample position based on pitch
+		i--;
+	}
+}
 
-				i--;
-			}
+INT32 QscUpdate(INT32 nEnd)
+{
+	INT32 nLen;
+
+	if (nEnd > nBurnSoundLen) {
+		nEnd = nBurnSoundLen;
+	}
+
+	nLen = nEnd - nPos;
+
+	if (nLen <= 0) {
+		return 0;
+	}
+
+	UINT64 nProfile = BurnSoundProfileStart();
+
+	if (Tams < nLen) {
+		BurnFree(Qs_s);
+		Tams = nLen;
+		Qs_s = (INT32*)BurnMalloc(sizeof(INT32) * 2 * Tams);
+	}
+
+	memset(Qs_s, 0, nLen * 2 * sizeof(INT32));
+
+	void (*pRenderChannel)(struct QChan_s*, INT32*, INT32);
+	if (nInterpolation < 3) {
+		pRenderChannel = QscRenderChannel_Linear;
+	} else {
+		pRenderChannel = QscRenderChannel_Cubic;
+	}
+
+	// Go through all channels, if the channel is playing, add the samples to the buffer
+	for (INT32 c = 0; c < 16; c++) {
+		if (QChan[c].bKey) {
+			pRenderChannel(&QChan[c], Qs_s, nLen);
 		}
 	}
-	
+
+	// An output that isn't routed to a side has a gain of 0 there
+	double dGain[2][2];
+	for (INT32 i = 0; i < 2; i++) {
+		dGain[i][0] = ((QsndOutputDir[i] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) ? QsndGain[i] : 0.0;
+		dGain[i][1] = ((QsndOutputDir[i] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) ? QsndGain[i] : 0.0;
+	}
+
 	INT16 *pDest = pBurnSoundOut + (nPos << 1);
 	INT32 *pSrc = Qs_s;
 	for (INT32 i = 0; i < nLen; i++) {
-		INT32 nLeftSample = 0, nRightSample = 0;
-			
-		if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
-		}
-		if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)((pSrc[(i << 1) + 0] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_1]);
-		}
-			
-		if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
-		}
-		if ((QsndOutputDir[BURN_SND_QSND_OUTPUT_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)((pSrc[(i << 1) + 1] >> 8) * QsndGain[BURN_SND_QSND_OUTPUT_2]);
-		}
-			
+		INT32 nLeftSample = (INT32)((pSrc[(i << 1) + 0] >> 8) * dGain[BURN_SND_QSND_OUTPUT_1][0]) + (INT32)((pSrc[(i << 1) + 1] >> 8) * dGain[BURN_SND_QSND_OUTPUT_2][0]);
+		INT32 nRightSample = (INT32)((pSrc[(i << 1) + 0] >> 8) * dGain[BURN_SND_QSND_OUTPUT_1][1]) + (INT32)((pSrc[(i << 1) + 1] >> 8) * dGain[BURN_SND_QSND_OUTPUT_2][1]);
+
 		pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
 		pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
 	}
-	nPos = nEnd;	
+	nPos = nEnd;
+
+	BurnSoundProfileStop(_T("QSound"), nProfile);
 
 	return 0;
 }
@@ -28,6 +28,19 @@ static double YM2610RightVolumes[3];
 
 INT32 bYM2610UseSeperateVolumes; // support custom Taito panning hardware
 
+// Rendering on a worker thread (bBurnSoundThread). The writes are pushed to pYM2610Queue with the
+// position they happen at, and the worker replays them in order, so the renders requested by the
+// chip while replaying go up to that position. The timers, the IRQ and status 0 stay on the emulation
+// thread, so writes to the timer registers (0x24 - 0x27), the other reads and CSM key ons are made
+// there once the worker is idle (bYM2610QueueDirect). Nothing else may run the chip there.
+static BurnSoundQueue* pYM2610Queue = NULL;
+static void (*BurnYM2610UpdateRender)(INT16* pSoundBuf, INT32 nSegmentEnd);
+
+static INT32 nYM2610QueuePosition;		// position of the write replayed on the worker
+static INT32 bYM2610QueueDirect = 0;	// the worker is idle, the chip runs on the emulation thread
+
+static INT32 nYM2610QueueAddress;		// address latch (0x100 set for port 1)
+
 // ----------------------------------------------------------------------------
 // Dummy functions
 
@@ -88,6 +101,20 @@ static void YM2610Render(INT32 nSegmentLength)
 // ----------------------------------------------------------------------------
 // Update the sound buffer
 
+static void YM2610SetInputs(BurnSoundInput* pInputs)
+{
+	for (INT32 i = 0; i < 3; i++) {
+		if (bYM2610UseSeperateVolumes) {
+			BurnSoundInputSetLR(&pInputs[i], pYM2610Buffer[i], YM2610LeftVolumes[i], YM2610RightVolumes[i]);
+		} else {
+			BurnSoundInputSet(&pInputs[i], pYM2610Buffer[i], YM2610Volumes[i], YM2610RouteDirs[i]);
+		}
+	}
+
+	BurnSoundInputAddBuffer(&pInputs[BURN_SND_YM2610_AY8910_ROUTE], pYM2610Buffer[3]);
+	BurnSoundInputAddBuffer(&pInputs[BURN_SND_YM2610_AY8910_ROUTE], pYM2610Buffer[4]);
+}
+
 static void YM2610UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 {
 #if defined FBA_DEBUG
@@ -107,7 +134,6 @@ static void YM2610UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (nSegmentLength > nBurnSoundLen) {
 		nSegmentLength = nBurnSoundLen;
 	}
-	nSegmentLength <<= 1;
 
 	YM2610Render(nSamplesNeeded);
 	AY8910Render(nSamplesNeeded);
@@ -123,99 +149,15 @@ static void YM2610UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2610Buffer[5][i] = BURN_SND_CLIP(pYM2610Buffer[2][i] + pYM2610Buffer[3][i] + pYM2610Buffer[4][i]);
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample, nTotalRightSample;
-		
-		if (bYM2610UseSeperateVolumes) {
-			nLeftSample[0] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 3] * YM2610LeftVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nLeftSample[1] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 2] * YM2610LeftVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nLeftSample[2] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 1] * YM2610LeftVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nLeftSample[3] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 0] * YM2610LeftVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			
-			nLeftSample[0] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 3] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nLeftSample[1] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 2] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nLeftSample[2] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 1] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nLeftSample[3] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 0] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			
-			nLeftSample[0] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 3] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nLeftSample[1] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 2] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nLeftSample[2] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 1] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nLeftSample[3] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 0] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				
-			nRightSample[0] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 3] * YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nRightSample[1] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 2] * YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nRightSample[2] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 1] * YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nRightSample[3] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 0] * YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			
-			nRightSample[0] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 3] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nRightSample[1] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 2] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nRightSample[2] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 1] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nRightSample[3] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 0] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			
-			nRightSample[0] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 3] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nRightSample[1] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 2] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nRightSample[2] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 1] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			nRightSample[3] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 0] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-		} else {
-			if ((YM2610RouteDirs[BURN_SND_YM2610_AY8910_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample[0] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nLeftSample[1] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nLeftSample[2] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nLeftSample[3] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_AY8910_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample[0] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nRightSample[1] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nRightSample[2] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-				nRightSample[3] += (INT32)(pYM2610Buffer[5][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			}
-		
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample[0] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nLeftSample[1] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nLeftSample[2] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nLeftSample[3] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample[0] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nRightSample[1] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nRightSample[2] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-				nRightSample[3] += (INT32)(pYM2610Buffer[0][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			}
-		
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample[0] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nLeftSample[1] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nLeftSample[2] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nLeftSample[3] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample[0] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 3] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nRightSample[1] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 2] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nRightSample[2] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 1] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-				nRightSample[3] += (INT32)(pYM2610Buffer[1][(nFractionalPosition >> 16) - 0] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			}
-		}
-		
-		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
-		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
-		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2610AddSignal) {
-//			pSoundBuf[i + 0] += nTotalLeftSample;
-//			pSoundBuf[i + 1] += nTotalRightSample;
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
-		}
-	}
-	
+	BurnSoundInput Inputs[3];
+	YM2610SetInputs(Inputs);
+
+	// the AY8910 channels are already mixed into buffer 5
+	Inputs[2].pBuffer[0] = pYM2610Buffer[5];
+	Inputs[2].nBuffers = 1;
+
+	nFractionalPosition = BurnSoundResample(pSoundBuf, nFractionalPosition >> 16, nSegmentLength, Inputs, 3, nFractionalPosition, nSampleSize, bYM2610AddSignal ? BURN_SND_MIX_ADD : BURN_SND_MIX_REPLACE);
+
 	if (nSegmentEnd >= nBurnSoundLen) {
 		INT32 nExtraSamples = nSamplesNeeded - (nFractionalPosition >> 16);
 
@@ -264,57 +206,10 @@ static void YM2610UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	pYM2610Buffer[3] = pBuffer + 4 + 3 * 4096;
 	pYM2610Buffer[4] = pBuffer + 4 + 4 * 4096;
 
-	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
-		INT32 nAYSample, nLeftSample = 0, nRightSample = 0;
+	BurnSoundInput Inputs[3];
+	YM2610SetInputs(Inputs);
 
-		nAYSample  = pYM2610Buffer[2][n];
-		nAYSample += pYM2610Buffer[3][n];
-		nAYSample += pYM2610Buffer[4][n];
-		
-		if (bYM2610UseSeperateVolumes) {
-			nLeftSample += (INT32)(nAYSample * YM2610LeftVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nLeftSample += (INT32)(pYM2610Buffer[0][n] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nLeftSample += (INT32)(pYM2610Buffer[1][n] * YM2610LeftVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			
-			nRightSample += (INT32)(nAYSample * YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			nRightSample += (INT32)(pYM2610Buffer[0][n] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			nRightSample += (INT32)(pYM2610Buffer[1][n] * YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-		} else {
-			if ((YM2610RouteDirs[BURN_SND_YM2610_AY8910_ROUTE] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(nAYSample * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_AY8910_ROUTE] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(nAYSample * YM2610Volumes[BURN_SND_YM2610_AY8910_ROUTE]);
-			}
-		
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(pYM2610Buffer[0][n] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(pYM2610Buffer[0][n] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_1]);
-			}
-		
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(pYM2610Buffer[1][n] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			}
-			if ((YM2610RouteDirs[BURN_SND_YM2610_YM2610_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(pYM2610Buffer[1][n] * YM2610Volumes[BURN_SND_YM2610_YM2610_ROUTE_2]);
-			}
-		}
-		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2610AddSignal) {
-			//pSoundBuf[(n << 1) + 0] += nLeftSample;
-			//pSoundBuf[(n << 1) + 1] += nRightSample;
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
-		}
-	}
+	BurnSoundMix(pSoundBuf, nFractionalPosition, nSegmentLength, Inputs, 3, bYM2610AddSignal ? BURN_SND_MIX_ADD : BURN_SND_MIX_REPLACE);
 
 	nFractionalPosition = nSegmentLength;
 
@@ -347,6 +242,11 @@ void BurnYM2610UpdateRequest()
 	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("YM2610UpdateRequest called without init\n"));
 #endif
 
+	if (pYM2610Queue && !bYM2610QueueDirect) {
+		YM2610Render(nYM2610QueuePosition);
+		return;
+	}
+
 	YM2610Render(BurnYM2610StreamCallback(nBurnYM2610SoundRate));
 }
 
@@ -356,9 +256,104 @@ static void BurnAY8910UpdateRequest()
 	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610 BurnAY8910UpdateRequest called without init\n"));
 #endif
 
+	if (pYM2610Queue && !bYM2610QueueDirect) {
+		AY8910Render(nYM2610QueuePosition);
+		return;
+	}
+
 	AY8910Render(BurnYM2610StreamCallback(nBurnYM2610SoundRate));
 }
 
+// ----------------------------------------------------------------------------
+// Chip access, through the worker when there's one
+
+// nCommand is the port written
+static void YM2610QueueReplay(INT32 nPosition, INT32 nCommand, INT32 nData)
+{
+	nYM2610QueuePosition = nPosition;
+
+	YM2610WriteQueued(0, nCommand, nData);
+}
+
+// Waits for the worker, then the chip can be run on this thread until the next push
+static void YM2610QueueSync()
+{
+	if (pYM2610Queue) {
+		BurnSoundQueueSync(pYM2610Queue);
+	}
+}
+
+void BurnYM2610Write(INT32 nAddress, INT32 nValue)
+{
+#if defined FBA_DEBUG
+	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610Write called without init\n"));
+#endif
+
+	if (pYM2610Queue == NULL) {
+		YM2610Write(0, nAddress, nValue);
+		return;
+	}
+
+	nAddress &= 3;
+	nValue &= 0xff;
+
+	if ((nAddress & 1) == 0) {
+		nYM2610QueueAddress = nValue | ((nAddress & 2) << 7);
+	} else {
+		if (nAddress == 1 && nYM2610QueueAddress >= 0x24 && nYM2610QueueAddress <= 0x27) {
+			YM2610QueueSync();
+			bYM2610QueueDirect = 1;
+			YM2610Write(0, nAddress, nValue);
+			bYM2610QueueDirect = 0;
+			return;
+		}
+	}
+
+	BurnSoundQueuePush(pYM2610Queue, BurnYM2610StreamCallback(nBurnYM2610SoundRate), nAddress, nValue);
+}
+
+UINT8 BurnYM2610Read(INT32 nAddress)
+{
+#if defined FBA_DEBUG
+	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610Read called without init\n"));
+#endif
+
+	// status 0 only has the timer flags
+	if (pYM2610Queue == NULL || (nAddress & 3) == 0) {
+		return YM2610Read(0, nAddress);
+	}
+
+	YM2610QueueSync();
+	bYM2610QueueDirect = 1;
+	UINT8 nRet = YM2610Read(0, nAddress);
+	bYM2610QueueDirect = 0;
+
+	return nRet;
+}
+
+static INT32 YM2610TimerOverQueued(INT32 n, INT32 c)
+{
+	// in CSM mode timer A keys on channel 3
+	if (c == 0 && YM2610TimerAKeyOn(n)) {
+		YM2610QueueSync();
+		bYM2610QueueDirect = 1;
+		INT32 nRet = YM2610TimerOver(n, c);
+		bYM2610QueueDirect = 0;
+		return nRet;
+	}
+
+	// otherwise only the timer state and status change
+	return YM2610TimerOver(n, c);
+}
+
+static void YM2610UpdateQueued(INT16* pSoundBuf, INT32 nSegmentEnd)
+{
+	YM2610QueueSync();
+	bYM2610QueueDirect = 1;
+	BurnYM2610UpdateRender(pSoundBuf, nSegmentEnd);
+	bYM2610QueueDirect = 0;
+}
+
 // ----------------------------------------------------------------------------
 // Initialisation, etc.
 
@@ -370,7 +365,10 @@ void BurnYM2610Reset()
 
 	BurnTimerReset();
 
+	YM2610QueueSync();
+	bYM2610QueueDirect = 1;
 	YM2610ResetChip(0);
+	bYM2610QueueDirect = 0;
 }
 
 void BurnYM2610Exit()
@@ -381,6 +379,9 @@ void BurnYM2610Exit()
 
 	if (!DebugSnd_YM2610Initted) return;
 
+	BurnSoundQueueExit(pYM2610Queue);
+	pYM2610Queue = NULL;
+
 	YM2610Shutdown();
 	AY8910Exit(0);
 
@@ -401,6 +402,7 @@ void BurnYM2610MapADPCMROM(UINT8* YM2610ADPCMAROM, INT32 nYM2610ADPCMASize, UINT
 	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610MapADPCMROM called without init\n"));
 #endif
 
+	YM2610QueueSync();
 	YM2610SetRom(0, YM2610ADPCMAROM, nYM2610ADPCMASize, YM2610ADPCMBROM, nYM2610ADPCMBSize);
 }
 
@@ -412,8 +414,14 @@ INT32 BurnYM2610Init(INT32 nClockFrequency, UINT8* YM2610ADPCMAROM, INT32* nYM26
 INT32 BurnYM2610Init(INT32 nClockFrequency, UINT8* YM2610ADPCMAROM, INT32* nYM2610ADPCMASize, UINT8* YM2610ADPCMBROM, INT32* nYM2610ADPCMBSize, FM_IRQHANDLER IRQCallback, INT32 (*StreamCallback)(INT32), double (*GetTimeCallback)(), INT32 bAddSignal)
 {
 	DebugSnd_YM2610Initted = 1;
-	
-	BurnTimerInit(&YM2610TimerOver, GetTimeCallback);
+
+	// the chips are set up on this thread
+	pYM2610Queue = (nBurnSoundRate > 0) ? BurnSoundQueueInit(YM2610QueueReplay) : NULL;
+	nYM2610QueuePosition = 0;
+	bYM2610QueueDirect = 1;
+	nYM2610QueueAddress = 0;
+
+	BurnTimerInit(pYM2610Queue ? &YM2610TimerOverQueued : &YM2610TimerOver, GetTimeCallback);
 
 	if (nBurnSoundRate <= 0) {
 		BurnYM2610StreamCallback = YM2610StreamCallbackDummy;
@@ -475,6 +483,14 @@ INT32 BurnYM2610Init(INT32 nClockFrequency, UINT8* YM2610ADPCMAROM, INT32* nYM26
 	YM2610RightVolumes[BURN_SND_YM2610_YM2610_ROUTE_2] = 1.00;
 	YM2610RightVolumes[BURN_SND_YM2610_AY8910_ROUTE] = 1.00;
 
+	if (pYM2610Queue) {
+		BurnYM2610UpdateRender = BurnYM2610Update;
+		BurnYM2610Update = YM2610UpdateQueued;
+	}
+	bYM2610QueueDirect = 0;
+
+	BurnYM2610Update = BurnSoundProfileWrap(_T("YM2610"), BurnYM2610Update);
+
 	return 0;
 }
 
@@ -515,6 +531,8 @@ void BurnYM2610Scan(INT32 nAction, INT32* pnMin)
 	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610Scan called without init\n"));
 #endif
 
+	YM2610QueueSync();
+
 	BurnTimerScan(nAction, pnMin);
 	AY8910Scan(nAction, pnMin);
 
@@ -522,4 +540,8 @@ void BurnYM2610Scan(INT32 nAction, INT32* pnMin)
 		SCAN_VAR(nYM2610Position);
 		SCAN_VAR(nAY8910Position);
 	}
+
+	if (pYM2610Queue && (nAction & ACB_WRITE)) {
+		nYM2610QueueAddress = YM2610GetAddress(0);
+	}
 }
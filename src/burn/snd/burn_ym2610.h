@@ -30,10 +30,5 @@ extern INT32 bYM2610UseSeperateVolumes;
 	BurnYM2610SetRoute(BURN_SND_YM2610_YM2610_ROUTE_2, v, d);	\
 	BurnYM2610SetRoute(BURN_SND_YM2610_AY8910_ROUTE  , v, d);
 	
-#define BurnYM2610Read(a) YM2610Read(0, a)
-
-#if defined FBA_DEBUG
-	#define BurnYM2610Write(a, n) if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("BurnYM2610Write called without init\n")); YM2610Write(0, a, n)
-#else
-	#define BurnYM2610Write(a, n) YM2610Write(0, a, n)
-#endif
+UINT8 BurnYM2610Read(INT32 nAddress);
+void BurnYM2610Write(INT32 nAddress, INT32 nValue);
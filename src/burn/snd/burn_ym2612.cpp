@@ -70,21 +70,12 @@ static void YM2612Render(INT32 nSegmentLength)
 
 // Update the sound buffer
 
-#define INTERPOLATE_ADD_SOUND_LEFT(route, buffer)																	\
-	if ((YM2612RouteDirs[route] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {									\
-		nLeftSample[0] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 3] * YM2612Volumes[route]);	\
-		nLeftSample[1] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 2] * YM2612Volumes[route]);	\
-		nLeftSample[2] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 1] * YM2612Volumes[route]);	\
-		nLeftSample[3] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 0] * YM2612Volumes[route]);	\
-	}
-
-#define INTERPOLATE_ADD_SOUND_RIGHT(route, buffer)																	\
-	if ((YM2612RouteDirs[route] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {									\
-		nRightSample[0] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 3] * YM2612Volumes[route]);	\
-		nRightSample[1] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 2] * YM2612Volumes[route]);	\
-		nRightSample[2] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 1] * YM2612Volumes[route]);	\
-		nRightSample[3] += (INT32)(pYM2612Buffer[buffer][(nFractionalPosition >> 16) - 0] * YM2612Volumes[route]);	\
+static void YM2612SetInputs(BurnSoundInput* pInputs)
+{
+	for (INT32 i = 0; i < nNumChips * 2; i++) {
+		BurnSoundInputSet(&pInputs[i], pYM2612Buffer[i], YM2612Volumes[i], YM2612RouteDirs[i]);
 	}
+}
 
 static void YM2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 {
@@ -102,7 +93,6 @@ static void YM2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 	if (nSegmentLength > nBurnSoundLen) {
 		nSegmentLength = nBurnSoundLen;
 	}
-	nSegmentLength <<= 1;
 
 	YM2612Render(nSamplesNeeded);
 
@@ -113,38 +103,11 @@ static void YM2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2612Buffer[3] = pBuffer + 3 * 4096 + 4;
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample, nTotalRightSample;
+	BurnSoundInput Inputs[2 * MAX_YM2612];
+	YM2612SetInputs(Inputs);
+
+	nFractionalPosition = BurnSoundResample(pSoundBuf, nFractionalPosition >> 16, nSegmentLength, Inputs, nNumChips * 2, nFractionalPosition, nSampleSize, bYM2612AddSignal ? BURN_SND_MIX_ADD : BURN_SND_MIX_REPLACE);
 
-		INTERPOLATE_ADD_SOUND_LEFT  (BURN_SND_YM2612_YM2612_ROUTE_1, 0)
-		INTERPOLATE_ADD_SOUND_RIGHT (BURN_SND_YM2612_YM2612_ROUTE_1, 0)
-		INTERPOLATE_ADD_SOUND_LEFT  (BURN_SND_YM2612_YM2612_ROUTE_2, 1)
-		INTERPOLATE_ADD_SOUND_RIGHT (BURN_SND_YM2612_YM2612_ROUTE_2, 1)
-		
-		if (nNumChips > 1) {
-			INTERPOLATE_ADD_SOUND_LEFT  (2 + BURN_SND_YM2612_YM2612_ROUTE_1, 2)
-			INTERPOLATE_ADD_SOUND_RIGHT (2 + BURN_SND_YM2612_YM2612_ROUTE_1, 2)
-			INTERPOLATE_ADD_SOUND_LEFT  (2 + BURN_SND_YM2612_YM2612_ROUTE_2, 3)
-			INTERPOLATE_ADD_SOUND_RIGHT (2 + BURN_SND_YM2612_YM2612_ROUTE_2, 3)
-		}
-		
-		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
-		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
-		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2612AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
-		}
-	}
-	
 	if (nSegmentEnd >= nBurnSoundLen) {
 		INT32 nExtraSamples = nSamplesNeeded - (nFractionalPosition >> 16);
 
@@ -191,50 +154,10 @@ static void YM2612UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2612Buffer[3] = pBuffer + 4 + 3 * 4096;
 	}
 
-	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
-		INT32 nLeftSample = 0, nRightSample = 0;
+	BurnSoundInput Inputs[2 * MAX_YM2612];
+	YM2612SetInputs(Inputs);
 
-		if ((YM2612RouteDirs[BURN_SND_YM2612_YM2612_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(pYM2612Buffer[0][n] * YM2612Volumes[BURN_SND_YM2612_YM2612_ROUTE_1]);
-		}
-		if ((YM2612RouteDirs[BURN_SND_YM2612_YM2612_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(pYM2612Buffer[0][n] * YM2612Volumes[BURN_SND_YM2612_YM2612_ROUTE_1]);
-		}
-		
-		if ((YM2612RouteDirs[BURN_SND_YM2612_YM2612_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(pYM2612Buffer[1][n] * YM2612Volumes[BURN_SND_YM2612_YM2612_ROUTE_2]);
-		}
-		if ((YM2612RouteDirs[BURN_SND_YM2612_YM2612_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(pYM2612Buffer[1][n] * YM2612Volumes[BURN_SND_YM2612_YM2612_ROUTE_2]);
-		}
-		
-		if (nNumChips > 1) {
-			if ((YM2612RouteDirs[2 + BURN_SND_YM2612_YM2612_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(pYM2612Buffer[2][n] * YM2612Volumes[2 + BURN_SND_YM2612_YM2612_ROUTE_1]);
-			}
-			if ((YM2612RouteDirs[2 + BURN_SND_YM2612_YM2612_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(pYM2612Buffer[2][n] * YM2612Volumes[2 + BURN_SND_YM2612_YM2612_ROUTE_1]);
-			}
-		
-			if ((YM2612RouteDirs[2 + BURN_SND_YM2612_YM2612_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(pYM2612Buffer[3][n] * YM2612Volumes[2 + BURN_SND_YM2612_YM2612_ROUTE_2]);
-			}
-			if ((YM2612RouteDirs[2 + BURN_SND_YM2612_YM2612_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(pYM2612Buffer[3][n] * YM2612Volumes[2 + BURN_SND_YM2612_YM2612_ROUTE_2]);
-			}
-		}
-		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2612AddSignal) {
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
-		}
-	}
+	BurnSoundMix(pSoundBuf, nFractionalPosition, nSegmentLength, Inputs, nNumChips * 2, bYM2612AddSignal ? BURN_SND_MIX_ADD : BURN_SND_MIX_REPLACE);
 
 	nFractionalPosition = nSegmentLength;
 
@@ -375,6 +298,8 @@ INT32 BurnYM2612Init(INT32 num, INT32 nClockFrequency, FM_IRQHANDLER IRQCallback
 		YM2612RouteDirs[2 + BURN_SND_YM2612_YM2612_ROUTE_2] = BURN_SND_ROUTE_RIGHT;
 	}
 
+	BurnYM2612Update = BurnSoundProfileWrap(_T("YM2612"), BurnYM2612Update);
+
 	return 0;
 }
 
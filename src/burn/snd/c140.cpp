@@ -237,6 +237,8 @@ void c140_update(INT16 *outputs, INT32 samples_len)
 		return;
 	}
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	INT32 nSamplesNeeded = ((((((m_sample_rate * 1000) / nBurnFPS) * samples_len) / nBurnSoundLen)) / 10) + 1;
 	if (nBurnSoundRate < 44100) nSamplesNeeded += 2; // so we don't end up with negative nPosition below
 
@@ -444,6 +446,8 @@ void c140_update(INT16 *outputs, INT32 samples_len)
 
 		nPosition = nExtraSamples;
 	}
+
+	BurnSoundProfileStop(_T("C140"), nProfile);
 }
 
 
@@ -120,6 +120,8 @@ void DACUpdate(INT16* Buffer, INT32 Length)
 	if (!DebugSnd_DACInitted) bprintf(PRINT_ERROR, _T("DACUpdate called without init\n"));
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	struct dac_info *ptr;
 
 	for (INT32 i = 0; i < NumChips; i++) {
@@ -155,6 +157,8 @@ void DACUpdate(INT16* Buffer, INT32 Length)
 		ptr = &dac_table[i];
 		ptr->nCurrentPosition = 0;
 	}
+
+	BurnSoundProfileStop(_T("DAC"), nProfile);
 }
 
 void DACWrite(INT32 Chip, UINT8 Data)
@@ -880,6 +880,8 @@ void ES5506Update(INT16 *outputs, INT32 samples_len)
 		return;
 	}
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 #if 0
 	if (chip->sample_rate == 0) { // probably not needed.. but try if garbage sound issues during boot (before chip->sample_rate is set)
 		memset(outputs, 0, nBurnSoundLen * 2 * sizeof(INT16));
@@ -933,6 +935,8 @@ void ES5506Update(INT16 *outputs, INT32 samples_len)
 
 		nPosition = nExtraSamples;
 	}
+
+	BurnSoundProfileStop(_T("ES5506"), nProfile);
 }
 
 
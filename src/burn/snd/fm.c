@@ -1493,6 +1493,30 @@ INLINE void update_phase_lfo_channel(FM_OPN *OPN, FM_CH *CH)
 	}
 }
 
+/* advance the phase counters of a channel by one sample */
+INLINE void chan_phase(FM_OPN *OPN, FM_CH *CH, int chnum)
+{
+	if(CH->pms)
+	{
+		/* add support for 3 slot mode */
+		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		{
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+		}
+		else update_phase_lfo_channel(OPN, CH);
+	}
+	else	/* no LFO phase modulation */
+	{
+		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+	}
+}
+
 INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 {
 	unsigned int eg_out;
@@ -1546,25 +1570,7 @@ INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 	CH->mem_value = mem;
 
 	/* update phase counters AFTER output calculations */
-	if(CH->pms)
-	{
-		/* add support for 3 slot mode */
-		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
-		{
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
-		}
-		else update_phase_lfo_channel(OPN, CH);
-	}
-	else	/* no LFO phase modulation */
-	{
-		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
-	}
+	chan_phase(OPN, CH, chnum);
 }
 
 /* update phase increment and envelope generator */
@@ -1636,6 +1642,355 @@ static void refresh_fc_eg_chan(FM_OPN *OPN, FM_CH *CH )
 	}
 }
 
+/* Block rendering.
+   An update is rendered FM_BLOCK_LEN samples at a time: the LFO and the envelope generator timer
+   are clocked for the whole block first, then each channel is rendered on its own from the start
+   to the end of the block into blk_out_fm[] and the update functions mix those buffers.
+   The channels of a chip share no state inside a sample, so this gives the same output as
+   rendering all channels sample by sample. The one exception is the SSG-EG release code in
+   advance_eg_channel(), which rewrites OPN->type; chips other than the YM2612 that have SSG-EG
+   enabled are rendered sample by sample. */
+
+#define FM_BLOCK_LEN	256
+
+/* length of the block starting at sample i of an update */
+#define FM_BLOCK_AT(i, length)	(((length) - (i) < FM_BLOCK_LEN) ? ((length) - (i)) : FM_BLOCK_LEN)
+
+/* output (out_fm[]) index of the channels in cch[] */
+static const UINT8 opn_chnum[6] = { 0, 1, 2, 3, 4, 5 };
+static const UINT8 ym2610_chnum[4] = { 1, 2, 4, 5 };
+
+static UINT32	blk_lfo_am[FM_BLOCK_LEN];		/* LFO_AM of each sample */
+static INT32	blk_lfo_pm[FM_BLOCK_LEN];		/* LFO_PM of each sample */
+static UINT32	blk_eg_cnt[FM_BLOCK_LEN];		/* eg_cnt before the envelope clocks of each sample */
+static UINT32	blk_eg_clocks[FM_BLOCK_LEN];	/* envelope generator clocks of each sample */
+static INT32	blk_out_fm[6][FM_BLOCK_LEN];	/* output of each channel */
+
+/* clock the LFO and the envelope generator timer over a block */
+static void opn_block_clock(FM_OPN *OPN, int length, int lfo)
+{
+	int i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (lfo)
+		{
+			advance_lfo(OPN);
+			blk_lfo_am[i] = LFO_AM;
+			blk_lfo_pm[i] = LFO_PM;
+		}
+		else
+		{
+			blk_lfo_am[i] = 0;
+			blk_lfo_pm[i] = 0;
+		}
+
+		blk_eg_cnt[i] = OPN->eg_cnt;
+
+		OPN->eg_timer += OPN->eg_timer_add;
+		while (OPN->eg_timer >= OPN->eg_timer_overflow)
+		{
+			OPN->eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_cnt++;
+		}
+
+		blk_eg_clocks[i] = OPN->eg_cnt - blk_eg_cnt[i];
+	}
+}
+
+/* run the envelope generator clocks of sample i on one channel */
+INLINE void opn_block_eg(FM_OPN *OPN, FM_CH *CH, int i)
+{
+	UINT32 cnt = blk_eg_cnt[i];
+	UINT32 end = cnt + blk_eg_clocks[i];
+
+	while (cnt != end)
+	{
+		OPN->eg_cnt = ++cnt;
+		advance_eg_channel(OPN, &CH->SLOT[SLOT1]);
+	}
+}
+
+/* are all operators of the channel quiet, with envelopes that can only get quieter? */
+static int opn_chan_quiet(FM_CH *CH)
+{
+	int s;
+
+	if (CH->op1_out[0] || CH->op1_out[1])
+		return 0;
+
+	for (s = 0; s < 4; s++)
+	{
+		FM_SLOT *SLOT = &CH->SLOT[s];
+
+		/* attack, decay (clamped down to SL on the YM2612) and SSG-EG can lower the attenuation */
+		if (SLOT->state > EG_SUS || (SLOT->ssg & 0x08))
+			return 0;
+
+		if (SLOT->vol_out < ENV_QUIET || SLOT->volume + SLOT->tl < ENV_QUIET)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* operator output destinations of a channel, for opn_block_chan_fast() */
+enum { BUS_M2 = 0, BUS_C1, BUS_C2, BUS_MEM, BUS_OUT, BUS_NONE, BUS_OTHER };
+
+static int opn_bus(INT32 *p, int chnum)
+{
+	if (p == NULL)				return BUS_NONE;	/* algorithm 5 */
+	if (p == &m2)				return BUS_M2;
+	if (p == &c1)				return BUS_C1;
+	if (p == &c2)				return BUS_C2;
+	if (p == &mem)				return BUS_MEM;
+	if (p == &out_fm[chnum])	return BUS_OUT;
+
+	return BUS_OTHER;
+}
+
+#define OPN_BUS_ADD(bus, v)										\
+	switch (bus)												\
+	{															\
+		case BUS_M2:	bm2  += (v); break;						\
+		case BUS_C1:	bc1  += (v); break;						\
+		case BUS_C2:	bc2  += (v); break;						\
+		case BUS_MEM:	bmem += (v); break;						\
+		case BUS_OUT:	bout += (v); break;						\
+	}
+
+/* the same as chan_calc() over a block for a channel without SSG-EG or LFO phase modulation,
+   with the operator state kept in locals */
+static void opn_block_chan_fast(FM_OPN *OPN, FM_CH *CH, int chnum, int length, int eg_first, int bus1, int bus3, int bus2, int busm)
+{
+	FM_SLOT *SLOT = CH->SLOT;
+	INT32 *buf = blk_out_fm[chnum];
+
+	UINT32 phase1 = SLOT[SLOT1].phase, phase2 = SLOT[SLOT2].phase, phase3 = SLOT[SLOT3].phase, phase4 = SLOT[SLOT4].phase;
+	UINT32 incr1 = SLOT[SLOT1].Incr, incr2 = SLOT[SLOT2].Incr, incr3 = SLOT[SLOT3].Incr, incr4 = SLOT[SLOT4].Incr;
+	UINT32 vol1 = SLOT[SLOT1].vol_out, vol2 = SLOT[SLOT2].vol_out, vol3 = SLOT[SLOT3].vol_out, vol4 = SLOT[SLOT4].vol_out;
+	UINT32 amask1 = SLOT[SLOT1].AMmask, amask2 = SLOT[SLOT2].AMmask, amask3 = SLOT[SLOT3].AMmask, amask4 = SLOT[SLOT4].AMmask;
+
+	INT32 op1_prev = CH->op1_out[0], op1_curr = CH->op1_out[1];
+	INT32 mem_value = CH->mem_value;
+	int fb = CH->FB, ams = CH->ams;
+	int i;
+
+	for (i = 0; i < length; i++)
+	{
+		INT32 bm2 = 0, bc1 = 0, bc2 = 0, bmem = 0, bout = 0;
+		UINT32 AM, env;
+
+		if (eg_first && blk_eg_clocks[i])
+		{
+			opn_block_eg(OPN, CH, i);
+			vol1 = SLOT[SLOT1].vol_out; vol2 = SLOT[SLOT2].vol_out; vol3 = SLOT[SLOT3].vol_out; vol4 = SLOT[SLOT4].vol_out;
+		}
+
+		AM = blk_lfo_am[i] >> ams;
+
+		OPN_BUS_ADD(busm, mem_value)
+
+		{
+			INT32 out = op1_prev + op1_curr;
+			op1_prev = op1_curr;
+
+			if (bus1 == BUS_NONE)
+			{
+				/* algorithm 5 */
+				bmem = bc1 = bc2 = op1_prev;
+			}
+			else
+			{
+				OPN_BUS_ADD(bus1, op1_prev)
+			}
+
+			op1_curr = 0;
+			env = vol1 + (AM & amask1);
+			if (env < ENV_QUIET)
+				op1_curr = op_calc1(phase1, env, fb ? (out << fb) : 0);
+		}
+
+		env = vol3 + (AM & amask3);
+		if (env < ENV_QUIET)
+		{
+			INT32 v = op_calc(phase3, env, bm2);
+			OPN_BUS_ADD(bus3, v)
+		}
+
+		env = vol2 + (AM & amask2);
+		if (env < ENV_QUIET)
+		{
+			INT32 v = op_calc(phase2, env, bc1);
+			OPN_BUS_ADD(bus2, v)
+		}
+
+		env = vol4 + (AM & amask4);
+		if (env < ENV_QUIET)
+			bout += op_calc(phase4, env, bc2);
+
+		mem_value = bmem;
+		buf[i] = bout;
+
+		phase1 += incr1;
+		phase2 += incr2;
+		phase3 += incr3;
+		phase4 += incr4;
+
+		if (!eg_first && blk_eg_clocks[i])
+		{
+			opn_block_eg(OPN, CH, i);
+			vol1 = SLOT[SLOT1].vol_out; vol2 = SLOT[SLOT2].vol_out; vol3 = SLOT[SLOT3].vol_out; vol4 = SLOT[SLOT4].vol_out;
+		}
+	}
+
+	SLOT[SLOT1].phase = phase1;
+	SLOT[SLOT2].phase = phase2;
+	SLOT[SLOT3].phase = phase3;
+	SLOT[SLOT4].phase = phase4;
+
+	CH->op1_out[0] = op1_prev;
+	CH->op1_out[1] = op1_curr;
+	CH->mem_value = mem_value;
+}
+
+#undef OPN_BUS_ADD
+
+/* render one channel over a block */
+static void opn_block_chan(FM_OPN *OPN, FM_CH *CH, int chnum, int length, int eg_first)
+{
+	INT32 *buf = blk_out_fm[chnum];
+	int i;
+
+	if (opn_chan_quiet(CH))
+	{
+		/* nothing to output, only the envelopes and the phase counters move */
+		for (i = 0; i < length; i++)
+		{
+			opn_block_eg(OPN, CH, i);
+
+			LFO_PM = blk_lfo_pm[i];
+			chan_phase(OPN, CH, chnum);
+
+			buf[i] = 0;
+		}
+
+		/* MEM only picks up quiet operators (or is not used at all) */
+		if (CH->mem_connect != &mem)
+			CH->mem_value = 0;
+
+		return;
+	}
+
+	if (!CH->pms && !((CH->SLOT[SLOT1].ssg | CH->SLOT[SLOT2].ssg | CH->SLOT[SLOT3].ssg | CH->SLOT[SLOT4].ssg) & 0x08))
+	{
+		int bus1 = opn_bus(CH->connect1, chnum);
+		int bus3 = opn_bus(CH->connect3, chnum);
+		int bus2 = opn_bus(CH->connect2, chnum);
+		int busm = opn_bus(CH->mem_connect, chnum);
+
+		if (bus1 != BUS_OTHER && bus3 < BUS_NONE && bus2 < BUS_NONE && busm < BUS_NONE && CH->connect4 == &out_fm[chnum])
+		{
+			opn_block_chan_fast(OPN, CH, chnum, length, eg_first, bus1, bus3, bus2, busm);
+			return;
+		}
+	}
+
+	for (i = 0; i < length; i++)
+	{
+		if (eg_first)
+			opn_block_eg(OPN, CH, i);
+
+		LFO_AM = blk_lfo_am[i];
+		LFO_PM = blk_lfo_pm[i];
+
+		out_fm[chnum] = 0;
+		chan_calc(OPN, CH, chnum);
+		buf[i] = out_fm[chnum];
+
+		if (!eg_first)
+			opn_block_eg(OPN, CH, i);
+	}
+}
+
+/* clock the envelope generator of all channels for one sample */
+INLINE void opn_sample_eg(FM_OPN *OPN, FM_CH **CH, int nch)
+{
+	int c;
+
+	OPN->eg_timer += OPN->eg_timer_add;
+	while (OPN->eg_timer >= OPN->eg_timer_overflow)
+	{
+		OPN->eg_timer -= OPN->eg_timer_overflow;
+		OPN->eg_cnt++;
+
+		for (c = 0; c < nch; c++)
+			advance_eg_channel(OPN, &CH[c]->SLOT[SLOT1]);
+	}
+}
+
+/* render the channels CH[0] to CH[ncalc - 1] over a block into blk_out_fm[chnum[]];
+   the envelopes of CH[ncalc] to CH[nch - 1] are clocked but not rendered (YM2612 DAC).
+   lfo: the chip has an LFO, eg_first: the envelopes are clocked before the output is calculated */
+static void opn_block_render(FM_OPN *OPN, FM_CH **CH, const UINT8 *chnum, int nch, int ncalc, int length, int lfo, int eg_first)
+{
+	int c, i;
+
+	if (OPN->type != TYPE_YM2612)
+	{
+		for (c = 0; c < nch * 4; c++)
+		{
+			if (CH[c >> 2]->SLOT[c & 3].ssg & 0x08)
+				break;
+		}
+
+		if (c < nch * 4)
+		{
+			/* sample by sample */
+			for (i = 0; i < length; i++)
+			{
+				if (lfo)
+					advance_lfo(OPN);
+				else
+					LFO_AM = LFO_PM = 0;
+
+				if (eg_first)
+					opn_sample_eg(OPN, CH, nch);
+
+				for (c = 0; c < ncalc; c++)
+				{
+					out_fm[chnum[c]] = 0;
+					chan_calc(OPN, CH[c], chnum[c]);
+					blk_out_fm[chnum[c]][i] = out_fm[chnum[c]];
+				}
+
+				if (!eg_first)
+					opn_sample_eg(OPN, CH, nch);
+			}
+
+			return;
+		}
+	}
+
+	{
+		UINT32 eg_cnt;
+
+		opn_block_clock(OPN, length, lfo);
+		eg_cnt = OPN->eg_cnt;
+
+		for (c = 0; c < ncalc; c++)
+			opn_block_chan(OPN, CH[c], chnum[c], length, eg_first);
+
+		for (; c < nch; c++)
+		{
+			for (i = 0; i < length; i++)
+				opn_block_eg(OPN, CH[c], i);
+		}
+
+		OPN->eg_cnt = eg_cnt;
+	}
+}
+
 /* initialize time tables */
 static void init_timetables( FM_ST *ST , const UINT8 *dttable )
 {
@@ -2301,33 +2656,17 @@ void YM2203UpdateOne(int num, INT16 *buffer, int length)
 	/* buffering */
 	for (i=0; i < length ; i++)
 	{
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-		}
+		int k = i & (FM_BLOCK_LEN - 1);
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
+		if (k == 0)
+			opn_block_render(OPN, cch, opn_chnum, 3, 3, FM_BLOCK_AT(i, length), 0, 1);
 
 		/* buffering */
 		{
 			int lt;
 
-			lt = out_fm[0] + out_fm[1] + out_fm[2];
+			lt = blk_out_fm[0][k] + blk_out_fm[1][k] + blk_out_fm[2][k];
 
 			lt >>= FINAL_SH;
 
@@ -2987,42 +3326,16 @@ void YM2608UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
+		int k = i & (FM_BLOCK_LEN - 1);
 
-		advance_lfo(OPN);
+		/* calculate FM */
+		if (k == 0)
+			opn_block_render(OPN, cch, opn_chnum, 6, 6, FM_BLOCK_AT(i, length), 1, 1);
 
 		/* clear output acc. */
 		out_adpcm[OUTD_LEFT] = out_adpcm[OUTD_RIGHT]= out_adpcm[OUTD_CENTER] = 0;
 		out_delta[OUTD_LEFT] = out_delta[OUTD_RIGHT]= out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
-		}
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3043,18 +3356,18 @@ void YM2608UpdateOne(int num, INT16 **buffer, int length)
 			rt =  out_adpcm[OUTD_RIGHT] + out_adpcm[OUTD_CENTER];
 			lt += (out_delta[OUTD_LEFT]  + out_delta[OUTD_CENTER])>>9;
 			rt += (out_delta[OUTD_RIGHT] + out_delta[OUTD_CENTER])>>9;
-			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* shift right verified on real YM2608 */
-			rt += ((out_fm[0]>>1) & OPN->pan[1]);
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
-			lt += ((out_fm[3]>>1) & OPN->pan[6]);
-			rt += ((out_fm[3]>>1) & OPN->pan[7]);
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+			lt += ((blk_out_fm[0][k]>>1) & OPN->pan[0]);	/* shift right verified on real YM2608 */
+			rt += ((blk_out_fm[0][k]>>1) & OPN->pan[1]);
+			lt += ((blk_out_fm[1][k]>>1) & OPN->pan[2]);
+			rt += ((blk_out_fm[1][k]>>1) & OPN->pan[3]);
+			lt += ((blk_out_fm[2][k]>>1) & OPN->pan[4]);
+			rt += ((blk_out_fm[2][k]>>1) & OPN->pan[5]);
+			lt += ((blk_out_fm[3][k]>>1) & OPN->pan[6]);
+			rt += ((blk_out_fm[3][k]>>1) & OPN->pan[7]);
+			lt += ((blk_out_fm[4][k]>>1) & OPN->pan[8]);
+			rt += ((blk_out_fm[4][k]>>1) & OPN->pan[9]);
+			lt += ((blk_out_fm[5][k]>>1) & OPN->pan[10]);
+			rt += ((blk_out_fm[5][k]>>1) & OPN->pan[11]);
 
 			lt >>= FINAL_SH;
 			rt >>= FINAL_SH;
@@ -3569,36 +3882,16 @@ void YM2610UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
+		int k = i & (FM_BLOCK_LEN - 1);
 
-		advance_lfo(OPN);
+		/* calculate FM */
+		if (k == 0)
+			opn_block_render(OPN, cch, ym2610_chnum, 4, 4, FM_BLOCK_AT(i, length), 1, 1);
 
 		/* clear output acc. */
 		out_adpcm[OUTD_LEFT] = out_adpcm[OUTD_RIGHT]= out_adpcm[OUTD_CENTER] = 0;
 		out_delta[OUTD_LEFT] = out_delta[OUTD_RIGHT]= out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-		}
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 1 );	/*remapped to 1*/
-		chan_calc(OPN, cch[1], 2 );	/*remapped to 2*/
-		chan_calc(OPN, cch[2], 4 );	/*remapped to 4*/
-		chan_calc(OPN, cch[3], 5 );	/*remapped to 5*/
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3621,15 +3914,15 @@ void YM2610UpdateOne(int num, INT16 **buffer, int length)
 			rt += (out_delta[OUTD_RIGHT] + out_delta[OUTD_CENTER])>>9;
 
 
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);	/* the shift right was verified on real chip */
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
+			lt += ((blk_out_fm[1][k]>>1) & OPN->pan[2]);	/* the shift right was verified on real chip */
+			rt += ((blk_out_fm[1][k]>>1) & OPN->pan[3]);
+			lt += ((blk_out_fm[2][k]>>1) & OPN->pan[4]);
+			rt += ((blk_out_fm[2][k]>>1) & OPN->pan[5]);
 
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+			lt += ((blk_out_fm[4][k]>>1) & OPN->pan[8]);
+			rt += ((blk_out_fm[4][k]>>1) & OPN->pan[9]);
+			lt += ((blk_out_fm[5][k]>>1) & OPN->pan[10]);
+			rt += ((blk_out_fm[5][k]>>1) & OPN->pan[11]);
 
 
 			lt >>= FINAL_SH;
@@ -3704,42 +3997,16 @@ void YM2610BUpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
+		int k = i & (FM_BLOCK_LEN - 1);
 
-		advance_lfo(OPN);
+		/* calculate FM */
+		if (k == 0)
+			opn_block_render(OPN, cch, opn_chnum, 6, 6, FM_BLOCK_AT(i, length), 1, 1);
 
 		/* clear output acc. */
 		out_adpcm[OUTD_LEFT] = out_adpcm[OUTD_RIGHT]= out_adpcm[OUTD_CENTER] = 0;
 		out_delta[OUTD_LEFT] = out_delta[OUTD_RIGHT]= out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
-		}
-
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3761,18 +4028,18 @@ void YM2610BUpdateOne(int num, INT16 **buffer, int length)
 			lt += (out_delta[OUTD_LEFT]  + out_delta[OUTD_CENTER])>>9;
 			rt += (out_delta[OUTD_RIGHT] + out_delta[OUTD_CENTER])>>9;
 
-			lt += ((out_fm[0]>>1) & OPN->pan[0]);	/* the shift right is verified on YM2610 */
-			rt += ((out_fm[0]>>1) & OPN->pan[1]);
-			lt += ((out_fm[1]>>1) & OPN->pan[2]);
-			rt += ((out_fm[1]>>1) & OPN->pan[3]);
-			lt += ((out_fm[2]>>1) & OPN->pan[4]);
-			rt += ((out_fm[2]>>1) & OPN->pan[5]);
-			lt += ((out_fm[3]>>1) & OPN->pan[6]);
-			rt += ((out_fm[3]>>1) & OPN->pan[7]);
-			lt += ((out_fm[4]>>1) & OPN->pan[8]);
-			rt += ((out_fm[4]>>1) & OPN->pan[9]);
-			lt += ((out_fm[5]>>1) & OPN->pan[10]);
-			rt += ((out_fm[5]>>1) & OPN->pan[11]);
+			lt += ((blk_out_fm[0][k]>>1) & OPN->pan[0]);	/* the shift right is verified on YM2610 */
+			rt += ((blk_out_fm[0][k]>>1) & OPN->pan[1]);
+			lt += ((blk_out_fm[1][k]>>1) & OPN->pan[2]);
+			rt += ((blk_out_fm[1][k]>>1) & OPN->pan[3]);
+			lt += ((blk_out_fm[2][k]>>1) & OPN->pan[4]);
+			rt += ((blk_out_fm[2][k]>>1) & OPN->pan[5]);
+			lt += ((blk_out_fm[3][k]>>1) & OPN->pan[6]);
+			rt += ((blk_out_fm[3][k]>>1) & OPN->pan[7]);
+			lt += ((blk_out_fm[4][k]>>1) & OPN->pan[8]);
+			rt += ((blk_out_fm[4][k]>>1) & OPN->pan[9]);
+			lt += ((blk_out_fm[5][k]>>1) & OPN->pan[10]);
+			rt += ((blk_out_fm[5][k]>>1) & OPN->pan[11]);
 
 
 			lt >>= FINAL_SH;
@@ -4042,7 +4309,7 @@ void YM2610ResetChip(int num)
 /* n = number  */
 /* a = address */
 /* v = value   */
-int YM2610Write(int n, int a, UINT8 v)
+static void ym2610_write(int n, int a, UINT8 v)
 {
 	YM2610 *F2610 = &(FM2610[n]);
 	FM_OPN *OPN   = &(FM2610[n].OPN);
@@ -4145,13 +4412,24 @@ int YM2610Write(int n, int a, UINT8 v)
 		else
 			OPNWriteReg(OPN,addr | 0x100,v);
 	}
-	return OPN->ST.irq;
+}
+
+int YM2610Write(int n, int a, UINT8 v)
+{
+	ym2610_write(n,a,v);
+	return FM2610[n].OPN.ST.irq;
+}
+
+/* write without reading back the IRQ state, for a chip whose timers are run by another thread */
+void YM2610WriteQueued(int n, int a, UINT8 v)
+{
+	ym2610_write(n,a,v);
 }
 
 UINT8 YM2610Read(int n,int a)
 {
 	YM2610 *F2610 = &(FM2610[n]);
-	int addr = F2610->OPN.ST.address;
+	int addr;
 	UINT8 ret = 0;
 
 	switch( a&3){
@@ -4159,6 +4437,7 @@ UINT8 YM2610Read(int n,int a)
 		ret = FM_STATUS_FLAG(&F2610->OPN.ST) & 0x83;
 		break;
 	case 1:	/* data 0 */
+		addr = F2610->OPN.ST.address;
 		if( addr < 16 ) ret = SSGRead(n);
 		if( addr == 0xff ) ret = 0x01;
 		break;
@@ -4186,18 +4465,31 @@ int YM2610TimerOver(int n,int c)
 	}
 	else
 	{	/* Timer A */
-		YM2610UpdateReq(n);
 		/* timer update */
 		TimerAOver( &(F2610->OPN.ST) );
 		/* CSM mode key,TL controll */
 		if( F2610->OPN.ST.mode & 0x80 )
 		{	/* CSM mode total level latch and auto key on */
+			/* (only the key on needs the stream up to date) */
+			YM2610UpdateReq(n);
 			CSMKeyControll( F2610->OPN.type, &(F2610->CH[2]) );
 		}
 	}
 	return F2610->OPN.ST.irq;
 }
 
+/* timer A over keys on channel 3 (CSM mode) */
+int YM2610TimerAKeyOn(int n)
+{
+	return (FM2610[n].OPN.ST.mode & 0x80) ? 1 : 0;
+}
+
+/* address latch, bit 8 set for port 1 */
+int YM2610GetAddress(int n)
+{
+	return FM2610[n].OPN.ST.address | (FM2610[n].addr_A1 << 8);
+}
+
 #endif /* (BUILD_YM2610||BUILD_YM2610B) */
 
 
@@ -4272,58 +4564,30 @@ void YM2612UpdateOne(int num, INT16 **buffer, int length)
 	/* buffering */
 	for(i=0; i < length ; i++)
 	{
+		int k = i & (FM_BLOCK_LEN - 1);
 
-		advance_lfo(OPN);
+		/* calculate FM, the DAC replaces channel 6 */
+		if (k == 0)
+			opn_block_render(OPN, cch, opn_chnum, 6, dacen ? 5 : 6, FM_BLOCK_AT(i, length), 1, 0);
 
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-		
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
 		if( dacen )
-			*cch[5]->connect4 += dacout;
-		else
-			chan_calc(OPN, cch[5], 5 );
-
-		/* advance envelope generator */
-		OPN->eg_timer += OPN->eg_timer_add;
-		while (OPN->eg_timer >= OPN->eg_timer_overflow)
-		{
-			OPN->eg_timer -= OPN->eg_timer_overflow;
-			OPN->eg_cnt++;
-
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
-		}
+			blk_out_fm[5][k] = dacout;
 
 		{
 			int lt,rt;
 
-			lt  = ((out_fm[0]>>0) & OPN->pan[0]);
-			rt  = ((out_fm[0]>>0) & OPN->pan[1]);
-			lt += ((out_fm[1]>>0) & OPN->pan[2]);
-			rt += ((out_fm[1]>>0) & OPN->pan[3]);
-			lt += ((out_fm[2]>>0) & OPN->pan[4]);
-			rt += ((out_fm[2]>>0) & OPN->pan[5]);
-			lt += ((out_fm[3]>>0) & OPN->pan[6]);
-			rt += ((out_fm[3]>>0) & OPN->pan[7]);
-			lt += ((out_fm[4]>>0) & OPN->pan[8]);
-			rt += ((out_fm[4]>>0) & OPN->pan[9]);
-			lt += ((out_fm[5]>>0) & OPN->pan[10]);
-			rt += ((out_fm[5]>>0) & OPN->pan[11]);
+			lt  = ((blk_out_fm[0][k]>>0) & OPN->pan[0]);
+			rt  = ((blk_out_fm[0][k]>>0) & OPN->pan[1]);
+			lt += ((blk_out_fm[1][k]>>0) & OPN->pan[2]);
+			rt += ((blk_out_fm[1][k]>>0) & OPN->pan[3]);
+			lt += ((blk_out_fm[2][k]>>0) & OPN->pan[4]);
+			rt += ((blk_out_fm[2][k]>>0) & OPN->pan[5]);
+			lt += ((blk_out_fm[3][k]>>0) & OPN->pan[6]);
+			rt += ((blk_out_fm[3][k]>>0) & OPN->pan[7]);
+			lt += ((blk_out_fm[4][k]>>0) & OPN->pan[8]);
+			rt += ((blk_out_fm[4][k]>>0) & OPN->pan[9]);
+			lt += ((blk_out_fm[5][k]>>0) & OPN->pan[10]);
+			rt += ((blk_out_fm[5][k]>>0) & OPN->pan[11]);
 			
 			lt >>= FINAL_SH;
 			rt >>= FINAL_SH;
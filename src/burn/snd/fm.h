@@ -201,8 +201,11 @@ void YM2610BUpdateOne(int num, INT16 **buffer, int length);
 #endif
 
 int YM2610Write(int n, int a,unsigned char v);
+void YM2610WriteQueued(int n, int a,unsigned char v);
 unsigned char YM2610Read(int n,int a);
 int YM2610TimerOver(int n, int c );
+int YM2610TimerAKeyOn(int n);
+int YM2610GetAddress(int n);
 #endif /* BUILD_YM2610 */
 
 #if BUILD_YM2612
@@ -700,7 +700,9 @@ void ics2115_update(INT32 segment_length)
 		return;
 
 	// bprintf(0, _T("    ICS2115 rendering %03i - %03i (%03i)\n"), stream_pos, segment_length, nBurnSoundLen);
+	UINT64 nProfile = BurnSoundProfileStart();
 	ics2115_render(pBurnSoundOut + stream_pos * 2, segment_length - stream_pos);
+	BurnSoundProfileStop(_T("ICS2115"), nProfile);
 
 	stream_pos = segment_length;
 	if (stream_pos >= nBurnSoundLen)
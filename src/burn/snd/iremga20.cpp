@@ -77,6 +77,8 @@ void iremga20_update(INT32 device, INT16 *buffer, INT32 length)
 	if (device > nNumChips) bprintf(PRINT_ERROR, _T("iremga20_update called with invalid chip %x\n"), device);
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	chip = &chips[device];
 	UINT32 rate[4], pos[4], frac[4], end[4], vol[4], play[4];
 	UINT8 *pSamples;
@@ -158,6 +160,8 @@ void iremga20_update(INT32 device, INT16 *buffer, INT32 length)
 		chip->channel[i].frac = frac[i];
 		chip->channel[i].play = play[i];
 	}
+
+	BurnSoundProfileStop(_T("GA20"), nProfile);
 }
 
 void iremga20_write(INT32 device, INT32 offset, INT32 data)
@@ -74,6 +74,8 @@ void K007232Update(INT32 chip, INT16* pSoundBuf, INT32 nLength)
 	if (chip >nNumChips) bprintf(PRINT_ERROR, _T("K007232Update called with invalid chip %x\n"), chip);
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	INT32 i;
 
 	Chip = &Chips[chip];
@@ -146,6 +148,8 @@ void K007232Update(INT32 chip, INT16* pSoundBuf, INT32 nLength)
 		pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + nRightSample);
 		pSoundBuf += 2;
 	}
+
+	BurnSoundProfileStop(_T("K007232"), nProfile);
 }
 
 UINT8 K007232ReadReg(INT32 chip, INT32 r)
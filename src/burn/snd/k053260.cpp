@@ -159,6 +159,8 @@ void K053260Update(INT32 chip, INT16 *pBuf, INT32 length)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("K053260Update called with invalid chip %x\n"), chip);
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	static const INT8 dpcmcnv[] = { 0,1,2,4,8,16,32,64, -128, -64, -32, -16, -8, -4, -2, -1};
 
 	INT32 lvol[4], rvol[4], play[4], loop[4], ppcm[4];
@@ -273,6 +275,8 @@ void K053260Update(INT32 chip, INT16 *pBuf, INT32 length)
 		ic->channels[i].play = play[i];
 		ic->channels[i].ppcm_data = ppcm_data[i];
 	}
+
+	BurnSoundProfileStop(_T("K053260"), nProfile);
 }
 
 void K053260Init(INT32 chip, INT32 clock, UINT8 *rom, INT32 nLen)
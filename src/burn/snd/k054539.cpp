@@ -401,6 +401,8 @@ void K054539Update(INT32 chip, INT16 *outputs, INT32 samples_len)
 	if(!(info->regs[0x22f] & 1))
 		return;
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	// re-sampleizer pt.1
 	INT32 nSamplesNeeded = ((((((48000 * 1000) / nBurnFPS) * samples_len) / nBurnSoundLen)) / 10);
 	if (nBurnSoundRate < 44100) nSamplesNeeded += 2; // so we don't end up with negative nPosition[chip] below
@@ -669,6 +671,8 @@ void K054539Update(INT32 chip, INT16 *outputs, INT32 samples_len)
 		nPosition[chip] = nExtraSamples;
 	}
 	//  -4 -3 -2 -1 0 +1 +2 +3 +4
+
+	BurnSoundProfileStop(_T("K054539"), nProfile);
 }
 
 void K054539Scan(INT32 nAction, INT32 *)
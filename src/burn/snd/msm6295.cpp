@@ -87,9 +87,6 @@ static INT32 MSM6295StepShift[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
 
 static INT32* MSM6295ChannelData[MAX_MSM6295][4];
 
-static INT32* pLeftBuffer = NULL;
-static INT32* pRightBuffer = NULL;
-
 static INT32 nPreviousSample[MAX_MSM6295], nCurrentSample[MAX_MSM6295];
 
 static bool bAdd;
@@ -145,91 +142,149 @@ void MSM6295Scan(INT32 , INT32 *)
 	}
 }
 
-static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+#define MSM6295_BLOCK	1024
+
+// One block of native rate output, the sum of the 4 channels of a chip
+static INT32 MSM6295Block[MSM6295_BLOCK];
+static INT32 MSM6295Mix[MSM6295_BLOCK];
+
+// Decode nTicks samples of a playing channel and add them to pBlock. The bank pointer is looked up once per
+// 256 byte page, not for every nibble.
+static void MSM6295DecodeChannel(INT32 nChip, INT32 nChannel, INT32* pBlock, INT32 nTicks)
 {
-	INT32 nVolume = MSM6295[nChip].nVolume;
-	INT32 nFractionalPosition = MSM6295[nChip].nFractionalPosition;
+	MSM6295ChannelInfo* pChannelInfo = &MSM6295[nChip].ChannelInfo[nChannel];
 
-	INT32 nChannel, nDelta, nSample;
-	MSM6295ChannelInfo* pChannelInfo;
+	INT32 nDecode = nTicks;
 
-	while (nSegmentLength--) {
-		if (nFractionalPosition >= 0x1000) {
+	// Check for end of sample
+	if (pChannelInfo->nSampleCount >= 0 && pChannelInfo->nSampleCount < nTicks) {
+		nDecode = pChannelInfo->nSampleCount;
 
-			nPreviousSample[nChip] = nCurrentSample[nChip];
+		pChannelInfo->nSampleCount = -1;
+		nMSM6295Status[nChip] &= ~(1 << nChannel);
+		pChannelInfo->nPlaying = 0;
+	} else {
+		pChannelInfo->nSampleCount -= nTicks;
+	}
 
-			do {
-				nCurrentSample[nChip] = 0;
+	if (nDecode == 0) return;
 
-				for (nChannel = 0; nChannel < 4; nChannel++) {
-					if (nMSM6295Status[nChip] & (1 << nChannel)) {
-						pChannelInfo = &MSM6295[nChip].ChannelInfo[nChannel];
+	INT32 nPosition = pChannelInfo->nPosition;
+	INT32 nData = pChannelInfo->nDelta;
+	INT32 nSample = pChannelInfo->nSample;
+	INT32 nStep = pChannelInfo->nStep;
+	INT32 nVolume = pChannelInfo->nVolume;
 
-						// Check for end of sample
-						if (pChannelInfo->nSampleCount-- == 0) {
-							nMSM6295Status[nChip] &= ~(1 << nChannel);
-							MSM6295[nChip].ChannelInfo[nChannel].nPlaying = 0;
-							continue;
-						}
+	for (INT32 i = 0; i < nDecode; ) {
+		const UINT8* pPage = pBankPointer[nChip][((nPosition >> 1) & 0x3ffff) >> 8];
 
-						// Get new delta from ROM
-						if (pChannelInfo->nPosition & 1) {
-							nDelta = pChannelInfo->nDelta & 0x0F;
-						} else {
-							pChannelInfo->nDelta = MSM6295ReadData(nChip, (pChannelInfo->nPosition >> 1) & 0x3ffff);
-							nDelta = pChannelInfo->nDelta >> 4;
-						}
+		// nibbles left in this page
+		INT32 nEnd = i + 0x200 - (nPosition & 0x1ff);
+		if (nEnd > nDecode) nEnd = nDecode;
 
-						// Compute new sample
-						nSample = pChannelInfo->nSample + MSM6295DeltaTable[(pChannelInfo->nStep << 4) + nDelta];
-						if (nSample > 2047) {
-							nSample = 2047;
-						} else {
-							if (nSample < -2048) {
-								nSample = -2048;
-							}
-						}
-						pChannelInfo->nSample = nSample;
-						pChannelInfo->nOutput = (nSample * pChannelInfo->nVolume);
+		for (; i < nEnd; i++, nPosition++) {
+			INT32 nDelta;
 
-						// Update step value
-						pChannelInfo->nStep = pChannelInfo->nStep + MSM6295StepShift[nDelta & 7];
-						if (pChannelInfo->nStep > 48) {
-							pChannelInfo->nStep = 48;
-						} else {
-							if (pChannelInfo->nStep < 0) {
-								pChannelInfo->nStep = 0;
-							}
-						}
+			// Get new delta from ROM
+			if (nPosition & 1) {
+				nDelta = nData & 0x0F;
+			} else {
+				nData = pPage ? pPage[(nPosition >> 1) & 0xff] : 0;
+				nDelta = nData >> 4;
+			}
 
-						nCurrentSample[nChip] += pChannelInfo->nOutput / 16;
+			// Compute new sample
+			nSample += MSM6295DeltaTable[(nStep << 4) + nDelta];
+			if (nSample > 2047) nSample = 2047;
+			if (nSample < -2048) nSample = -2048;
 
-						// Advance sample position
-						pChannelInfo->nPosition++;
-					}
-				}
+			// Update step value
+			nStep += MSM6295StepShift[nDelta & 7];
+			if (nStep > 48) nStep = 48;
+			if (nStep < 0) nStep = 0;
 
-				nFractionalPosition -= 0x1000;
+			pBlock[i] += (nSample * nVolume) / 16;
+		}
+	}
 
-			} while (nFractionalPosition >= 0x1000);
+	pChannelInfo->nPosition = nPosition;
+	pChannelInfo->nDelta = nData;
+	pChannelInfo->nSample = nSample;
+	pChannelInfo->nStep = nStep;
+	pChannelInfo->nOutput = nSample * nVolume;
+}
+
+// The chip is rendered in blocks: first every playing channel is decoded at the chip's own rate into MSM6295Block,
+// then that is resampled (linearly interpolated) to the output rate and mixed in.
+static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+{
+	INT32 nVolume = MSM6295[nChip].nVolume;
+	INT32 nFractionalPosition = MSM6295[nChip].nFractionalPosition;
+	INT32 nSampleSize = MSM6295[nChip].nSampleSize;
+
+	bool bLeft = (MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT;
+	bool bRight = (MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT;
+
+	INT32 nPrevious = nPreviousSample[nChip];
+	INT32 nCurrent = nCurrentSample[nChip];
+
+	while (nSegmentLength > 0) {
+		// as many output samples as there are chip samples for in one block
+		INT32 nLen = nSegmentLength;
+		if (nLen > MSM6295_BLOCK) nLen = MSM6295_BLOCK;
+		if (nSampleSize > 0) {
+			INT32 nMax = (((MSM6295_BLOCK + 1) << 12) - 1 - nFractionalPosition) / nSampleSize + 1;
+			if (nMax < 1) nMax = 1;
+			if (nLen > nMax) nLen = nMax;
 		}
 
-		// Compute linearly interpolated sample
-		nSample = nPreviousSample[nChip] + (((nCurrentSample[nChip] - nPreviousSample[nChip]) * nFractionalPosition) >> 12);
+		INT32 nTicks = (nFractionalPosition + (nLen - 1) * nSampleSize) >> 12;
+		if (nTicks > MSM6295_BLOCK) nTicks = MSM6295_BLOCK;
 
-		// Scale all 4 channels
-		nSample *= nVolume;
+		if (nTicks) {
+			memset(MSM6295Block, 0, nTicks * sizeof(INT32));
 
-		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			*pLeftBuf++ += nSample;
+			for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
+				if (nMSM6295Status[nChip] & (1 << nChannel)) {
+					MSM6295DecodeChannel(nChip, nChannel, MSM6295Block, nTicks);
+				}
+			}
 		}
-		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			*pRightBuf++ += nSample;
+
+		// Compute linearly interpolated samples, scaled by the chip volume
+		INT32 nTick = 0;
+		for (INT32 i = 0; i < nLen; i++) {
+			if (nFractionalPosition >= 0x1000) {
+				nTick += nFractionalPosition >> 12;
+				nFractionalPosition &= 0x0fff;
+
+				nPrevious = nCurrent;
+				nCurrent = MSM6295Block[nTick - 1];
+			}
+
+			MSM6295Mix[i] = (nPrevious + (((nCurrent - nPrevious) * nFractionalPosition) >> 12)) * nVolume;
+
+			nFractionalPosition += nSampleSize;
+		}
+
+		if (bLeft) {
+			for (INT32 i = 0; i < nLen; i++) {
+				pLeftBuf[i] += MSM6295Mix[i];
+			}
+			pLeftBuf += nLen;
+		}
+		if (bRight) {
+			for (INT32 i = 0; i < nLen; i++) {
+				pRightBuf[i] += MSM6295Mix[i];
+			}
+			pRightBuf += nLen;
 		}
 
-		nFractionalPosition += MSM6295[nChip].nSampleSize;
+		nSegmentLength -= nLen;
 	}
 
+	nPreviousSample[nChip] = nPrevious;
+	nCurrentSample[nChip] = nCurrent;
 	MSM6295[nChip].nFractionalPosition = nFractionalPosition;
 }
 
@@ -360,30 +415,24 @@ INT32 MSM6295Render(INT32 nChip, INT16* pSoundBuf, INT32 nSegmentLength) // rend
 	if (nChip > nLastMSM6295Chip) bprintf(PRINT_ERROR, _T("MSM6295Render called with invalid chip number %x\n"), nChip);
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	if (nChip == 0) {
-		memset(pLeftBuffer, 0, nSegmentLength * sizeof(INT32));
-		memset(pRightBuffer, 0, nSegmentLength * sizeof(INT32));
+		BurnSoundBusBegin(nSegmentLength);
 	}
 
 	if (nInterpolation >= 3) {
-		MSM6295Render_Cubic(nChip, pLeftBuffer, pRightBuffer, nSegmentLength);
+		MSM6295Render_Cubic(nChip, pBurnSoundBus[0], pBurnSoundBus[1], nSegmentLength);
 	} else {
-		MSM6295Render_Linear(nChip, pLeftBuffer, pRightBuffer, nSegmentLength);
+		MSM6295Render_Linear(nChip, pBurnSoundBus[0], pBurnSoundBus[1], nSegmentLength);
 	}
 
 	if (nChip == nLastMSM6295Chip)	{
-		for (INT32 i = 0; i < nSegmentLength; i++) {
-			if (bAdd) {
-				pSoundBuf[0] = BURN_SND_CLIP(pSoundBuf[0] + (pLeftBuffer[i] >> 8));
-				pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + (pRightBuffer[i] >> 8));
-			} else {
-				pSoundBuf[0] = BURN_SND_CLIP(pLeftBuffer[i] >> 8);
-				pSoundBuf[1] = BURN_SND_CLIP(pRightBuffer[i] >> 8);
-			}
-			pSoundBuf += 2;
-		}
+		BurnSoundBusFlush(pSoundBuf, nSegmentLength, bAdd);
 	}
 
+	BurnSoundProfileStop(_T("MSM6295"), nProfile);
+
 	return 0;
 }
 
@@ -485,11 +534,6 @@ void MSM6295Exit(INT32 nChip)
 
 	if (!DebugSnd_MSM6295Initted) return;
 
-	if (pLeftBuffer) BurnFree(pLeftBuffer);
-	if (pRightBuffer) BurnFree(pRightBuffer);
-	pLeftBuffer = NULL;
-	pRightBuffer = NULL;
-
 	for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
 		BurnFree(MSM6295ChannelData[nChip][nChannel]);
 	}
@@ -523,12 +567,7 @@ INT32 MSM6295Init(INT32 nChip, INT32 nSamplerate, bool bAddSignal)
 	DebugSnd_MSM6295Initted = 1;
 	
 	if (nBurnSoundRate > 0) {
-		if (pLeftBuffer == NULL) {
-			pLeftBuffer = (INT32*)BurnMalloc(nBurnSoundRate * sizeof(INT32));
-		}
-		if (pRightBuffer == NULL) {
-			pRightBuffer = (INT32*)BurnMalloc(nBurnSoundRate * sizeof(INT32));
-		}
+		BurnSoundBusBegin(nBurnSoundRate);
 	}
 
 	if (nChip == 0) {
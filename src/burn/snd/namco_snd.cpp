@@ -142,6 +142,8 @@ void NamcoSoundUpdate(INT16* buffer, INT32 length)
 	if (chip->sound_enable == 0)
 		return;
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	/* loop over each voice and add its contribution */
 	for (voice = chip->channel_list; voice < chip->last_channel; voice++)
 	{
@@ -215,6 +217,8 @@ void NamcoSoundUpdate(INT16* buffer, INT32 length)
 			}
 		}
 	}
+
+	BurnSoundProfileStop(_T("Namco"), nProfile);
 }
 
 void NamcoSoundUpdateStereo(INT16* buffer, INT32 length)
@@ -44,6 +44,8 @@ void RF5C68PCMUpdate(INT16* pSoundBuf, INT32 length)
 #endif
 
 	if (!chip->enable) return;
+
+	UINT64 nProfile = BurnSoundProfileStart();
 	
 	INT32 i, j;
 	
@@ -111,6 +113,8 @@ void RF5C68PCMUpdate(INT16* pSoundBuf, INT32 length)
 		pSoundBuf[1] = nRightSample;
 		pSoundBuf += 2;
 	}
+
+	BurnSoundProfileStop(_T("RF5C68"), nProfile);
 }
 
 void RF5C68PCMReset()
@@ -3,6 +3,11 @@
 #include "burnint.h"
 #include "samples.h"
 
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_SAMPLE_SSE2
+ #include <emmintrin.h>
+#endif
+
 #define SAMPLE_DIRECTORY	szAppSamplesPath
 
 #define get_long()	((ptr[3] << 24) | (ptr[2] << 16) | (ptr[1] << 8) | (ptr[0] << 0))
@@ -16,6 +21,8 @@ static inline UINT16 get_shorti(const UINT8* const p)
 static INT32 bAddToStream = 0;
 static INT32 nTotalSamples = 0;
 INT32 bBurnSampleTrimSampleEnd = 0;
+INT32 nBurnSampleCacheSize = 64 << 20;
+INT32 bBurnSampleCacheFile = 0;
 
 struct sample_format
 {
@@ -28,11 +35,55 @@ struct sample_format
 	INT32 playback_rate; // 100 = 100%, 200 = 200%, 
 	double gain[2];
 	INT32 output_dir[2];
+	INT32 entry;			// the wav in the sample archive, -1 if it isn't there
+	UINT32 wav_len;
+	UINT32 wav_crc;
+	INT32 cache_offset;		// the converted sample in the cache file, 0 if it isn't there
+	UINT32 cache_length;
+	UINT32 last_used;		// decoded samples that weren't used for longest are freed first
 };
 
 static struct sample_format *samples		= NULL; // store samples
 static struct sample_format *sample_ptr		= NULL; // generic pointer for sample
 
+// Samples are decoded on first play from the sample archive, which stays open until exit. Decoded samples
+// use at most nBurnSampleCacheSize bytes, if bBurnSampleCacheFile is set they are also kept in converted form
+// in <samplename>.samplecache next to the archive, so they don't have to be converted again next time.
+
+struct ZipArchive;
+struct ZipArchive* ZipArchiveOpen(char* szZip);
+INT32 ZipArchiveFind(struct ZipArchive* pArchive, const char* szName, UINT32* pnLen, UINT32* pnCrc);
+INT32 ZipArchiveLoadFile(struct ZipArchive* pArchive, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
+INT32 ZipArchiveClose(struct ZipArchive* pArchive);
+
+#define SAMPLECACHE_VERSION		1
+#define SAMPLECACHE_TRIMMED		(1 << 31)		// record flag, converted with bBurnSampleTrimSampleEnd
+
+struct SampleCacheHeader
+{
+	char szMagic[4];
+	UINT32 nVersion;
+	UINT32 nRate;
+	UINT32 nReserved;
+};
+
+// Followed by nLength frames of 16 bit stereo
+struct SampleCacheRecord
+{
+	UINT32 nCrc;
+	UINT32 nWavLen;
+	UINT32 nFlags;
+	UINT32 nLength;
+};
+
+static const char szSampleCacheMagic[4] = { 'F', 'B', 'S', 'C' };
+
+static struct ZipArchive *pSampleArchive = NULL;
+static FILE *fSampleCache = NULL;
+static INT32 nSampleCacheEnd = 0;			// where the next record is written
+static INT32 nSampleCacheUsed = 0;			// bytes of decoded samples in memory
+static UINT32 nSampleCacheTick = 0;
+
 static void make_raw(UINT8 *src, UINT32 len)
 {
 	UINT8 *ptr = src;
@@ -166,11 +217,195 @@ static void make_raw(UINT8 *src, UINT32 len)
 	}
 
 	sample_ptr->length = converted_len;
-	sample_ptr->playing = 0;
-	sample_ptr->position = 0;
 }
 
-void BurnSampleInitOne(INT32); // below...
+// The flags a converted sample depends on, besides the wav itself
+static UINT32 BurnSampleCacheFlags(struct sample_format *pSample)
+{
+	return (pSample->flags & SAMPLE_AUTOLOOP) | (bBurnSampleTrimSampleEnd ? SAMPLECACHE_TRIMMED : 0);
+}
+
+// Open (or start) the cache file and find the samples that are already in it
+static void BurnSampleCacheOpen(const char *szPath)
+{
+	if (!bBurnSampleCacheFile) return;
+
+	SampleCacheHeader Header;
+	memset(&Header, 0, sizeof(Header));
+
+	fSampleCache = fopen(szPath, "r+b");
+	if (fSampleCache) {
+		if (fread(&Header, 1, sizeof(Header), fSampleCache) != sizeof(Header) || memcmp(Header.szMagic, szSampleCacheMagic, 4) || Header.nVersion != SAMPLECACHE_VERSION || Header.nRate != (UINT32)nBurnSoundRate) {
+			fclose(fSampleCache);
+			fSampleCache = NULL;
+		}
+	}
+
+	if (fSampleCache == NULL) {
+		// missing, or made for another version or sound rate: start over
+		fSampleCache = fopen(szPath, "w+b");
+		if (fSampleCache == NULL) return;
+
+		memcpy(Header.szMagic, szSampleCacheMagic, 4);
+		Header.nVersion = SAMPLECACHE_VERSION;
+		Header.nRate = nBurnSoundRate;
+		Header.nReserved = 0;
+		if (fwrite(&Header, 1, sizeof(Header), fSampleCache) != sizeof(Header)) {
+			fclose(fSampleCache);
+			fSampleCache = NULL;
+			return;
+		}
+	}
+
+	fseek(fSampleCache, 0, SEEK_END);
+	INT32 nFileLen = (INT32)ftell(fSampleCache);
+
+	INT32 nFound = 0;
+	INT32 nOffset = sizeof(Header);
+	SampleCacheRecord Record;
+
+	// a record cut short (e.g. the last run didn't finish writing it) ends the file, new records overwrite it
+	while (fseek(fSampleCache, nOffset, SEEK_SET) == 0 && fread(&Record, 1, sizeof(Record), fSampleCache) == sizeof(Record)) {
+		if (Record.nLength > (UINT32)(nFileLen - nOffset - sizeof(Record)) / 4) break;
+
+		for (INT32 i = 0; i < nTotalSamples; i++) {
+			struct sample_format *pSample = &samples[i];
+			if (pSample->entry < 0 || pSample->cache_offset) continue;
+
+			if (pSample->wav_crc == Record.nCrc && pSample->wav_len == Record.nWavLen && BurnSampleCacheFlags(pSample) == Record.nFlags) {
+				pSample->cache_offset = nOffset + sizeof(Record);
+				pSample->cache_length = Record.nLength;
+				nFound++;
+			}
+		}
+
+		nOffset += sizeof(Record) + Record.nLength * 4;
+	}
+
+	nSampleCacheEnd = nOffset;
+
+	bprintf(0, _T("Sample cache %S: %d of %d samples\n"), szPath, nFound, nTotalSamples);
+}
+
+static INT32 BurnSampleCacheRead(struct sample_format *pSample)
+{
+	if (fSampleCache == NULL || pSample->cache_offset == 0 || pSample->cache_length == 0) return 1;
+
+	pSample->data = (UINT8*)BurnMalloc(pSample->cache_length * 4);
+	if (pSample->data == NULL) return 1;
+
+	// sizes in bytes, the libretro file streams return bytes rather than elements
+	UINT32 nBytes = pSample->cache_length * 4;
+
+	if (fseek(fSampleCache, pSample->cache_offset, SEEK_SET) || fread(pSample->data, 1, nBytes, fSampleCache) != nBytes) {
+		BurnFree(pSample->data);
+		pSample->cache_offset = 0;
+		return 1;
+	}
+
+	pSample->length = pSample->cache_length;
+
+	return 0;
+}
+
+static void BurnSampleCacheWrite(struct sample_format *pSample)
+{
+	if (fSampleCache == NULL || pSample->data == NULL || pSample->length == 0) return;
+
+	SampleCacheRecord Record;
+	Record.nCrc = pSample->wav_crc;
+	Record.nWavLen = pSample->wav_len;
+	Record.nFlags = BurnSampleCacheFlags(pSample);
+	Record.nLength = pSample->length;
+
+	UINT32 nBytes = pSample->length * 4;
+
+	if (fseek(fSampleCache, nSampleCacheEnd, SEEK_SET) || fwrite(&Record, 1, sizeof(Record), fSampleCache) != sizeof(Record) || fwrite(pSample->data, 1, nBytes, fSampleCache) != nBytes) {
+		// out of disk space or similar, don't try again
+		fclose(fSampleCache);
+		fSampleCache = NULL;
+		return;
+	}
+
+	fflush(fSampleCache);
+
+	pSample->cache_offset = nSampleCacheEnd + sizeof(Record);
+	pSample->cache_length = pSample->length;
+	nSampleCacheEnd += sizeof(Record) + nBytes;
+}
+
+static void BurnSampleCacheClose()
+{
+	if (fSampleCache) {
+		fclose(fSampleCache);
+		fSampleCache = NULL;
+	}
+
+	nSampleCacheEnd = 0;
+}
+
+static void BurnSampleUnload(INT32 sample)
+{
+	struct sample_format *pSample = &samples[sample];
+
+	if (pSample->data) {
+		nSampleCacheUsed -= pSample->length * 4;
+		BurnFree(pSample->data);
+	}
+}
+
+// Free the least recently used samples that aren't playing, until the decoded samples fit in nBurnSampleCacheSize again
+static void BurnSampleCacheTrim(INT32 nKeep)
+{
+	while (nBurnSampleCacheSize > 0 && nSampleCacheUsed > nBurnSampleCacheSize) {
+		INT32 nOldest = -1;
+
+		for (INT32 i = 0; i < nTotalSamples; i++) {
+			if (i == nKeep || samples[i].data == NULL || samples[i].playing) continue;
+			if (nOldest < 0 || samples[i].last_used < samples[nOldest].last_used) nOldest = i;
+		}
+
+		if (nOldest < 0) break;
+
+		BurnSampleUnload(nOldest);
+	}
+}
+
+// Make sure the sample is decoded, from the cache file or else from the sample archive
+static void BurnSampleLoad(INT32 sample)
+{
+	struct sample_format *pSample = &samples[sample];
+
+	pSample->last_used = ++nSampleCacheTick;
+
+	if (pSample->data || (pSample->flags & SAMPLE_IGNORE)) return;
+
+	if (BurnSampleCacheRead(pSample)) {
+		INT32 nWrote = 0;
+		UINT8 *pWav = (pSample->entry >= 0) ? (UINT8*)BurnMalloc(pSample->wav_len) : NULL;
+
+		if (pWav && ZipArchiveLoadFile(pSampleArchive, pWav, pSample->wav_len, &nWrote, pSample->entry) == 0 && nWrote) {
+			char *szSampleName = NULL;
+			BurnDrvGetSampleName(&szSampleName, sample, 0);
+			bprintf(0, _T("Loading \"%S\": "), szSampleName);
+			sample_ptr = pSample;
+			make_raw(pWav, nWrote);
+		}
+
+		BurnFree(pWav);
+
+		if (pSample->data == NULL) {
+			pSample->flags = SAMPLE_IGNORE; // don't try again
+			pSample->playing = 0;
+			return;
+		}
+
+		BurnSampleCacheWrite(pSample);
+	}
+
+	nSampleCacheUsed += pSample->length * 4;
+	BurnSampleCacheTrim(sample);
+}
 
 void BurnSamplePlay(INT32 sample)
 {
@@ -185,9 +420,21 @@ void BurnSamplePlay(INT32 sample)
 	if (sample_ptr->flags & SAMPLE_IGNORE) return;
 
 	if (sample_ptr->flags & SAMPLE_NOSTORE) {
-		BurnSampleInitOne(sample);
+		// only one of these is kept at a time
+		for (INT32 i = 0; i < nTotalSamples; i++) {
+			if (i != sample && (samples[i].flags & SAMPLE_NOSTORE)) {
+				samples[i].playing = 0;
+				samples[i].playback_rate = 100;
+				BurnSampleUnload(i);
+			}
+		}
 	}
 
+	BurnSampleLoad(sample);
+
+	sample_ptr = &samples[sample];
+	if (sample_ptr->data == NULL) return;
+
 	sample_ptr->playing = 1;
 	sample_ptr->position = 0;
 }
@@ -212,7 +459,11 @@ void BurnSampleResume(INT32 sample)
 
 	if (sample >= nTotalSamples) return;
 
+	BurnSampleLoad(sample);
+
 	sample_ptr = &samples[sample];
+	if (sample_ptr->data == NULL) return;
+
 	sample_ptr->playing = 1;
 }
 
@@ -306,7 +557,6 @@ void BurnSampleReset()
 	}
 }
 
-INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
 char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, INT32 nOutSize);
 #define _TtoA(a)	TCHARToANSI(a, NULL, 0)
 
@@ -314,6 +564,8 @@ void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 {
 	bAddToStream = bAdd;
 	nTotalSamples = 0;
+	nSampleCacheUsed = 0;
+	nSampleCacheTick = 0;
 
 	DebugSnd_SamplesInitted = 1;
 
@@ -322,43 +574,22 @@ void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 		return;
 	}
 
-	INT32 length;
 	char path[256*2];
 	char setname[128];
-	void *destination = NULL;
 	char szTempPath[MAX_PATH];
 	sprintf(szTempPath, _TtoA(SAMPLE_DIRECTORY));
 
-	// test to see if file exists
-	INT32 nEnableSamples = 0;
-
 	if (BurnDrvGetTextA(DRV_SAMPLENAME) == NULL) { // called with no samples
 		nTotalSamples = 0;
 		return;
 	}
 
 	strcpy(setname, BurnDrvGetTextA(DRV_SAMPLENAME));
-	sprintf(path, "%s%s.zip", szTempPath, setname);
-	
-	FILE *test = fopen(path, "rb");
-	if (test) 
-	{
-		nEnableSamples = 1;
-		fclose(test);
-	}
-	
-#ifdef INCLUDE_7Z_SUPPORT
-	sprintf(path, "%s%s.7z", szTempPath, setname);
-	
-	test = fopen(path, "rb");
-	if (test)
-	{	
-		nEnableSamples = 1;
-		fclose(test);
-	}
-#endif
-	
-	if (!nEnableSamples) return;
+	sprintf(path, "%s%s", szTempPath, setname);
+
+	// only the directory is read here, the samples are decoded when they are first played
+	pSampleArchive = ZipArchiveOpen(path);
+	if (pSampleArchive == NULL) return;
 
 	struct BurnSampleInfo si;
 	INT32 nSampleOffset = -1;
@@ -385,104 +616,18 @@ void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 
 		if (si.nFlags == 0) break;
 
-		if (si.nFlags & SAMPLE_NOSTORE) {
-			sample_ptr->flags = si.nFlags;
-			sample_ptr->data = NULL;
-			continue;
-		}
-
-		sprintf (path, "%s%s", szTempPath, setname);
-
-		destination = NULL;
-		length = 0;
-		ZipLoadOneFile((char*)path, (const char*)szSampleName, &destination, &length);
-		
-		if (length) {
-			sample_ptr->flags = si.nFlags;
-			bprintf(0, _T("Loading \"%S\": "), szSampleName);
-			make_raw((UINT8*)destination, length);
-		} else {
-			sample_ptr->flags = SAMPLE_IGNORE;
-		}
+		sample_ptr->entry = ZipArchiveFind(pSampleArchive, szSampleName, &sample_ptr->wav_len, &sample_ptr->wav_crc);
+		sample_ptr->flags = (sample_ptr->entry >= 0 && sample_ptr->wav_len) ? si.nFlags : SAMPLE_IGNORE;
 		
 		sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_1] = 1.00;
 		sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_2] = 1.00;
 		sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_1] = BURN_SND_ROUTE_BOTH;
 		sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_2] = BURN_SND_ROUTE_BOTH;
 		sample_ptr->playback_rate = 100;
-
-		BurnFree (destination);
-
-		BurnSetProgressRange(1.0 / nTotalSamples);
-		BurnUpdateProgress((double)1.0 / i * nTotalSamples, _T("Loading samples..."), 0);
-	}
-}
-
-void BurnSampleInitOne(INT32 sample)
-{
-	if (sample >= nTotalSamples) {
-		return;
-	}
-
-	{
-		struct sample_format *clr_ptr = &samples[0];
-
-		int i = 0;
-		while (i < nTotalSamples) {
-			
-			if (clr_ptr->data != NULL && i != sample && (clr_ptr->flags & SAMPLE_NOSTORE)) {
-				BurnFree(clr_ptr->data);
-				clr_ptr->playing = 0;
-				clr_ptr->playback_rate = 100;
-				clr_ptr->data = NULL;
-			}
-
-			clr_ptr++, i++;
-		}
-	}
-
-	if ((sample_ptr->flags & SAMPLE_NOSTORE) == 0) {
-		return;
-	}
-
-	INT32 length;
-	char path[256];
-	char setname[128];
-	void *destination = NULL;
-	char szTempPath[MAX_PATH];
-	sprintf(szTempPath, _TtoA(SAMPLE_DIRECTORY));
-
-	strcpy(setname, BurnDrvGetTextA(DRV_SAMPLENAME));
-	sprintf(path, "%s%s.zip", szTempPath, setname);
-
-	struct BurnSampleInfo si;
-	BurnDrvGetSampleInfo(&si, sample);
-	char *szSampleNameTmp = NULL;
-	BurnDrvGetSampleName(&szSampleNameTmp, sample, 0);
-
-	sample_ptr = &samples[sample];
-
-	// append .wav to filename
-	char szSampleName[1024];
-	memset(&szSampleName, 0, sizeof(szSampleName));
-	strncpy(&szSampleName[0], szSampleNameTmp, sizeof(szSampleName) - 5); // leave space for ".wav" + null, just incase!
-	strcat(&szSampleName[0], ".wav");
-
-	if (sample_ptr->playing || sample_ptr->data != NULL || sample_ptr->flags == SAMPLE_IGNORE) {
-		return;
 	}
 
-	sprintf (path, "%s%s", szTempPath, setname);
-
-	destination = NULL;
-	length = 0;
-	ZipLoadOneFile((char*)path, (const char*)szSampleName, &destination, &length);
-		
-	if (length) {
-		make_raw((UINT8*)destination, length);
-	}
-
-	BurnFree (destination);
+	sprintf(path, "%s%s.samplecache", szTempPath, setname);
+	BurnSampleCacheOpen(path);
 }
 
 void BurnSampleSetRoute(INT32 sample, INT32 nIndex, double nVolume, INT32 nRouteDir)
@@ -524,14 +669,18 @@ void BurnSampleExit()
 	if (!DebugSnd_SamplesInitted) return;
 
 	for (INT32 i = 0; i < nTotalSamples; i++) {
-		sample_ptr = &samples[i];
-		if (sample_ptr)
-			BurnFree (sample_ptr->data);
+		BurnSampleUnload(i);
 	}
 
 	if (samples)
 		BurnFree (samples);
 
+	ZipArchiveClose(pSampleArchive);
+	pSampleArchive = NULL;
+
+	BurnSampleCacheClose();
+	nSampleCacheUsed = 0;
+
 	sample_ptr = NULL;
 	nTotalSamples = 0;
 	bAddToStream = 0;
@@ -540,6 +689,161 @@ void BurnSampleExit()
 	DebugSnd_SamplesInitted = 0;
 }
 
+// Mix n frames of 16-bit stereo sample data into pDest. pGain holds the left gains of the two routes
+// (left and right channel of the sample), then the right gains, 0.0 for a route that isn't connected.
+static void BurnSampleMixFrames(INT16* pDest, const INT16* pSrc, INT32 n, const double* pGain)
+{
+	INT32 i = 0;
+
+#if defined BURN_SAMPLE_SSE2
+	const __m128d vLeft1 = _mm_set1_pd(pGain[0]), vLeft2 = _mm_set1_pd(pGain[1]);
+	const __m128d vRight1 = _mm_set1_pd(pGain[2]), vRight2 = _mm_set1_pd(pGain[3]);
+
+	for (; i + 2 <= n; i += 2) {
+		__m128i s = _mm_loadl_epi64((const __m128i*)(pSrc + i * 2));
+		s = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);					// l0 r0 l1 r1
+		__m128d l = _mm_cvtepi32_pd(_mm_shuffle_epi32(s, 0x08));			// l0 l1
+		__m128d r = _mm_cvtepi32_pd(_mm_shuffle_epi32(s, 0x0d));			// r0 r1
+
+		// every product is truncated on its own, like the C loop
+		__m128i nLeft = _mm_add_epi32(_mm_cvttpd_epi32(_mm_mul_pd(l, vLeft1)), _mm_cvttpd_epi32(_mm_mul_pd(r, vLeft2)));
+		__m128i nRight = _mm_add_epi32(_mm_cvttpd_epi32(_mm_mul_pd(l, vRight1)), _mm_cvttpd_epi32(_mm_mul_pd(r, vRight2)));
+
+		__m128i d = _mm_loadl_epi64((const __m128i*)(pDest + i * 2));
+		d = _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16), _mm_unpacklo_epi32(nLeft, nRight));
+		_mm_storel_epi64((__m128i*)(pDest + i * 2), _mm_packs_epi32(d, d));
+	}
+#endif
+
+	for (; i < n; i++) {
+		INT32 nLeftSample = (INT32)(pSrc[i * 2 + 0] * pGain[0]) + (INT32)(pSrc[i * 2 + 1] * pGain[1]);
+		INT32 nRightSample = (INT32)(pSrc[i * 2 + 0] * pGain[2]) + (INT32)(pSrc[i * 2 + 1] * pGain[3]);
+
+		pDest[i * 2 + 0] = BURN_SND_CLIP(nLeftSample + pDest[i * 2 + 0]);
+		pDest[i * 2 + 1] = BURN_SND_CLIP(nRightSample + pDest[i * 2 + 1]);
+	}
+}
+
+// Frame nFrame of a sample for the interpolation taps: wraps around for looping samples, else the ends are repeated
+static inline const INT16* BurnSampleTapFrame(const sample_format* pSample, INT32 nFrame)
+{
+	INT32 nLength = pSample->length;
+
+	if (nFrame < 0) {
+		nFrame = pSample->loop ? (nFrame + nLength) : 0;
+	} else if (nFrame >= nLength) {
+		nFrame = pSample->loop ? (nFrame - nLength) : (nLength - 1);
+	}
+	if (nFrame < 0 || nFrame >= nLength) nFrame = 0;		// samples shorter than the taps
+
+	return (INT16*)pSample->data + nFrame * 2;
+}
+
+// Render n frames starting at nPos (16.16), the caller makes sure none of them are past the end of the sample
+static void BurnSampleRenderSpan(const sample_format* pSample, INT16* pDest, INT32 n, UINT64 nPos, UINT32 nStep, const double* pGain)
+{
+	const INT16* pData = (INT16*)pSample->data;
+
+	if (nStep == 0x10000) {
+		BurnSampleMixFrames(pDest, pData + (nPos >> 16) * 2, n, pGain);
+		return;
+	}
+
+	for (INT32 i = 0; i < n; i++, pDest += 2, nPos += nStep) {
+		INT32 nFrame = (INT32)(nPos >> 16);
+		INT32 nLeft, nRight;
+
+		if (nInterpolation >= 3) {
+			const INT16* s0 = BurnSampleTapFrame(pSample, nFrame - 1);
+			const INT16* s1 = pData + nFrame * 2;
+			const INT16* s2 = BurnSampleTapFrame(pSample, nFrame + 1);
+			const INT16* s3 = BurnSampleTapFrame(pSample, nFrame + 2);
+			INT32 nFraction = (nPos >> 4) & 0x0fff;
+
+			nLeft = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(nFraction, s0[0], s1[0], s2[0], s3[0]));
+			nRight = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(nFraction, s0[1], s1[1], s2[1], s3[1]));
+		} else if (nInterpolation >= 1) {
+			const INT16* s0 = pData + nFrame * 2;
+			const INT16* s1 = BurnSampleTapFrame(pSample, nFrame + 1);
+			INT32 nFraction = (nPos >> 4) & 0x0fff;
+
+			nLeft = s0[0] + (((s1[0] - s0[0]) * nFraction) >> 12);
+			nRight = s0[1] + (((s1[1] - s0[1]) * nFraction) >> 12);
+		} else {
+			nLeft = pData[nFrame * 2 + 0];
+			nRight = pData[nFrame * 2 + 1];
+		}
+
+		INT32 nLeftSample = (INT32)(nLeft * pGain[0]) + (INT32)(nRight * pGain[1]);
+		INT32 nRightSample = (INT32)(nLeft * pGain[2]) + (INT32)(nRight * pGain[3]);
+
+		pDest[0] = BURN_SND_CLIP(nLeftSample + pDest[0]);
+		pDest[1] = BURN_SND_CLIP(nRightSample + pDest[1]);
+	}
+}
+
+// Add nLen frames of a playing sample to pDest, split into blocks that don't cross the end of the sample
+static void BurnSampleRenderOne(sample_format* pSample, INT16* pDest, INT32 nLen)
+{
+	INT32 nLength = pSample->length;
+	UINT64 nPos = pSample->position;
+	UINT64 nEnd = (UINT64)nLength << 16;
+	UINT32 nStep = (0x10000 * pSample->playback_rate) / 100;
+
+	if (nLength <= 0) {
+		pSample->playing = 0;
+		pSample->position = 0;
+		return;
+	}
+
+	double dGain[4];
+	for (INT32 i = 0; i < 2; i++) {
+		dGain[0 + i] = ((pSample->output_dir[i] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) ? pSample->gain[i] : 0.0;
+		dGain[2 + i] = ((pSample->output_dir[i] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) ? pSample->gain[i] : 0.0;
+	}
+
+	if (pSample->loop) {
+		nPos %= nEnd;
+	} else {
+		INT32 nRemaining = nLength - (INT32)(nPos >> 16);
+
+		// stop playback once the end was reached during the previous call
+		if (nRemaining <= 0) {
+			pSample->playing = 0;
+			pSample->position = 0;
+			return;
+		}
+
+		if (nLen > nRemaining) nLen = nRemaining;
+	}
+
+	while (nLen > 0) {
+		INT32 n = nLen;
+
+		if (nStep) {
+			UINT64 nFrames = (nEnd - nPos + nStep - 1) / nStep;
+			if ((UINT64)n > nFrames) n = (INT32)nFrames;
+		}
+
+		BurnSampleRenderSpan(pSample, pDest, n, nPos, nStep, dGain);
+
+		pDest += n * 2;
+		nLen -= n;
+		nPos += (UINT64)n * nStep;
+
+		if (nPos >= nEnd) {
+			if (pSample->loop) {
+				nPos %= nEnd;
+			} else if (nLen > 0) {
+				pSample->playing = 0;
+				break;
+			}
+		}
+	}
+
+	pSample->position = nPos; // store the updated position
+}
+
 void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 {
 #if defined FBA_DEBUG
@@ -550,6 +854,8 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 		return;
 	}
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	// if the sample player is the only, or the first, sound chip, clear out the sound buffer!
 	if (bAddToStream == 0) {
 		memset (pDest, 0, pLen * 2 * sizeof(INT16)); // clear buffer
@@ -558,65 +864,12 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 	for (INT32 i = 0; i < nTotalSamples; i++)
 	{
 		sample_ptr = &samples[i];
-		if (sample_ptr->playing == 0) continue;
-
-		INT32 playlen = pLen;
-		INT32 length = sample_ptr->length;
-		UINT64 pos = sample_ptr->position;
-		INT32 playback_rate = (0x10000 * sample_ptr->playback_rate) / 100;
-
-		INT16 *dst = pDest;
-		INT16 *dat = (INT16*)sample_ptr->data;
-		
-		if (sample_ptr->loop == 0) // if not looping, check to make sure sample is in bounds
-		{
-			INT32 current_pos = (pos / 0x10000);
-			// if sample position is greater than length, stop playback
-			if ((length - current_pos) <= 0) {
-				BurnSampleStop(i);
-				continue;
-			}
-
-			// if samples remaining are less than playlen, set playlen to samples remaining
-			if (playlen > (length - current_pos)) playlen = length - current_pos;
-		}
-		
-		length *= 2; // (stereo) used to ensure position is within bounds
-				
-		for (INT32 j = 0; j < playlen; j++, dst+=2, pos+=playback_rate) {
-			INT32 nLeftSample = 0, nRightSample = 0;
-			UINT32 current_pos = (pos / 0x10000);
-			UINT32 position = current_pos * 2; // ~1
-
-			if (sample_ptr->loop == 0) // if not looping, check to make sure sample is in bounds
-			{
-				// if sample position is greater than length, stop playback
-				if ((sample_ptr->length - current_pos) <= 0) {
-					BurnSampleStop(i);
-					break;
-				}
-			}
-
-			if ((sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(dat[(position) % length] * sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_1]);
-			}
-			if ((sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(dat[(position) % length] * sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_1]);
-			}
-
-			if ((sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)(dat[(position + 1) % length] * sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_2]);
-			}
-			if ((sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)(dat[(position + 1) % length] * sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_2]);
-			}
-
-			dst[0] = BURN_SND_CLIP(nLeftSample + dst[0]);
-			dst[1] = BURN_SND_CLIP(nRightSample + dst[1]);
-		}
+		if (sample_ptr->playing == 0 || sample_ptr->data == NULL) continue;
 
-		sample_ptr->position = pos; // store the updated position 
+		BurnSampleRenderOne(sample_ptr, pDest, pLen);
 	}
+
+	BurnSoundProfileStop(_T("Samples"), nProfile);
 }
 
 void BurnSampleScan(INT32 nAction, INT32 *pnMin)
@@ -636,6 +889,12 @@ void BurnSampleScan(INT32 nAction, INT32 *pnMin)
 			SCAN_VAR(sample_ptr->loop);
 			SCAN_VAR(sample_ptr->position);
 			SCAN_VAR(sample_ptr->playback_rate);
+
+			// samples playing in the state have to be decoded
+			if ((nAction & ACB_WRITE) && sample_ptr->playing) {
+				BurnSampleLoad(i);
+				if (samples[i].data == NULL) samples[i].playing = 0;
+			}
 		}
 	}
 }
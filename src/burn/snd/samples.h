@@ -2,8 +2,8 @@
 #define SAMPLE_AUTOLOOP		(1<<1) // start the looping on start
 #define SAMPLE_NOLOOP		(1<<2) // don't allow this to loop
 
-// Change this to 0 to 1 if using samples in a low-ram environment.
-// May cause momentary stutter while sample loads.
+// Samples are decoded when first played, and at most nBurnSampleCacheSize bytes of them are kept.
+// Change this to 0 to 1 to also keep only one of the samples flagged with it in memory at a time.
 #define SAMPLE_NOSTORE		(0<<3) // only keep in memory while playing
 
 void BurnSamplePlay(INT32 sample);
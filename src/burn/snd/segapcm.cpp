@@ -74,6 +74,8 @@ void SegaPCMUpdate(INT16* pSoundBuf, INT32 nLength)
 	if (!DebugSnd_SegaPCMInitted) bprintf(PRINT_ERROR, _T("SegaPCMUpdate called without init\n"));
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	for (INT32 i = 0; i < nNumChips + 1; i++) {
 		SegaPCMUpdateOne(i, nLength);
 	}
@@ -122,6 +124,8 @@ void SegaPCMUpdate(INT16* pSoundBuf, INT32 nLength)
 		pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + nRightSample);
 		pSoundBuf += 2;
 	}
+
+	BurnSoundProfileStop(_T("SegaPCM"), nProfile);
 }
 
 void SegaPCMInit(INT32 nChip, INT32 clock, INT32 bank, UINT8 *pPCMData, INT32 PCMDataSize)
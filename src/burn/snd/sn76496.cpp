@@ -45,6 +45,8 @@ void SN76496Update(INT32 Num, INT16* pSoundBuf, INT32 Length)
 
 	if (Num >= MAX_SN76496_CHIPS) return;
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	INT32 i;
 	struct SN76496 *R = Chips[Num];
 
@@ -195,6 +197,8 @@ void SN76496Update(INT32 Num, INT16* pSoundBuf, INT32 Length)
 		pSoundBuf += 2;
 		Length--;
 	}
+
+	BurnSoundProfileStop(_T("SN76496"), nProfile);
 }
 
 void SN76496UpdateToBuffer(INT32 Num, INT16* pSoundBuf, INT32 Length)
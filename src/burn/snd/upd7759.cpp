@@ -321,6 +321,8 @@ void UPD7759Update(INT32 chip, INT16 *pSoundBuf, INT32 nLength)
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("UPD7759Update called with invalid chip %x\n"), chip);
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	Chip = Chips[chip];
 
 	INT32 ClocksLeft = Chip->clocks_left;
@@ -384,6 +386,8 @@ void UPD7759Update(INT32 chip, INT16 *pSoundBuf, INT32 nLength)
 
 	Chip->clocks_left = ClocksLeft;
 	Chip->pos = Pos;
+
+	BurnSoundProfileStop(_T("UPD7759"), nProfile);
 }
 
 void UPD7759Reset()
@@ -500,6 +500,8 @@ INT32 YMZ280BRender(INT16* pSoundBuf, INT32 nSegmentLength)
 	if (!DebugSnd_YMZ280BInitted) bprintf(PRINT_ERROR, _T("YMZ280BRender called without init\n"));
 #endif
 
+	UINT64 nProfile = BurnSoundProfileStart();
+
 	memset(pBuffer, 0, nSegmentLength * 2 * sizeof(INT32));
 
 	for (nActiveChannel = 0; nActiveChannel < 8; nActiveChannel++) {
@@ -547,6 +549,8 @@ INT32 YMZ280BRender(INT16* pSoundBuf, INT32 nSegmentLength)
 		pSoundBuf[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
 	}
 
+	BurnSoundProfileStop(_T("YMZ280B"), nProfile);
+
 	return 0;
 }
 
@@ -15,6 +15,14 @@
 /* Scan driver data */
 INT32 BurnAreaScan(INT32 nAction, INT32* pnMin);
 
+/* The frontend may replace BurnAreaScan() with a cached list of the areas only for drivers which call
+   BurnAreaScanSetStatic() from their init: their scan passes the same areas on every ACB_READ and does
+   nothing else that matters between frames. Cores and devices which do more on ACB_READ call
+   BurnAreaScanSetDynamic(), which overrides it */
+void BurnAreaScanSetStatic();
+void BurnAreaScanSetDynamic();
+INT32 BurnAreaScanIsStatic();
+
 /* flags to use for nAction */
 #define ACB_READ		 ( 1)
 #define ACB_WRITE		 ( 2)
@@ -27,6 +27,8 @@ struct GenericTilemap {
 	INT32 dirty_tiles_enable;
 };
 
+bool bGenericTilemapThreads = false;
+
 static GenericTilemap maps[MAX_TILEMAPS];
 static GenericTilemap *cur_map;
 GenericTilesGfx GenericGfxData[MAX_TILEMAPS];
@@ -704,272 +706,346 @@ INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
 	return cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)];
 }
 
-void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority)
-{
-#if defined FBA_DEBUG
-	if (Bitmap == NULL) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized Bitmap!\n"), which, priority);
-		return;
-	}
-#endif
-
-	cur_map = &maps[which];
-
-#if defined FBA_DEBUG
-	if (cur_map->initialized == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized tilemap!\n"), which, priority);
-		return;
-	}
-#endif
-
-	if (cur_map->enable == 0) { // layer disabled!
-		return;
-	}
-
+// Parameters of a GenericTilemapDraw() call, shared by the threads drawing the scroll modes line by line
+struct GenericTilemapDrawParams {
+	GenericTilemap *map;
+	INT32 which;
+	UINT16 *Bitmap;
+	INT32 priority;
+	INT32 category_or;
+	INT32 opaque;
+	INT32 tgroup;
 	INT32 minx, maxx, miny, maxy;
-	GenericTilesGetClip(&minx, &maxx, &miny, &maxy);
-
-	// check clipping and fix clipping sizes if out of bounds
-	if (minx < 0 || maxx > nScreenWidth || miny < 0 || maxy > nScreenHeight) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d) called with improper clipping values (%d, %d, %d, %d)!"), which, priority, minx, maxx, miny, maxy);
-		bprintf (PRINT_ERROR, _T("pPrioDraw is %d pixels wide and %d pixels high!\n"), nScreenWidth, nScreenHeight);
+	void (*pDrawLines)(const GenericTilemapDrawParams *p, INT32 y0, INT32 y1);
+	INT32 nBands;
+};
 
-		if (minx < 0) minx = 0;
-		if (maxx >= nScreenWidth) maxx = nScreenWidth;
-		if (miny < 0) miny = 0;
-		if (maxy >= nScreenHeight) maxy = nScreenHeight;
-	}
+// column (less than tile size) and line scroll, lines y0 to y1 - 1
+static void GenericTilemapDrawColScrollLines(const GenericTilemapDrawParams *p, INT32 y0, INT32 y1)
+{
+	GenericTilemap *map = p->map;
+	UINT16 *Bitmap = p->Bitmap;
+	INT32 which = p->which, priority = p->priority, category_or = p->category_or, opaque = p->opaque, tgroup = p->tgroup;
+	INT32 minx = p->minx, maxx = p->maxx;
 
-	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
-	INT32 opaque = priority & TMAP_FORCEOPAQUE;
-	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
-	INT32 tgroup = (priority >> 8) & 0xff;
-	priority &= 0xff;
+	INT32 bitmap_width = maxx - minx;
+	INT32 scrymod = (map->mheight * map->theight);
+	INT32 scrxmod = (map->mwidth * map->twidth);
 
-	// column (less than tile size) and line scroll
-	if ((cur_map->scrolly_table != NULL) && (cur_map->scroll_cols > cur_map->mwidth))
+	for (INT32 y = y0; y < y1; y++)
 	{
-		INT32 bitmap_width = maxx - minx;
-		INT32 scrymod = (cur_map->mheight * cur_map->theight);
-		INT32 scrxmod = (cur_map->mwidth * cur_map->twidth);
-
-		for (INT32 y = miny; y < maxy; y++)
+		for (INT32 x = 0; x < bitmap_width; x++)
 		{
-			for (INT32 x = 0; x < bitmap_width; x++)
-			{
-				INT32 sx;
-				if (cur_map->scrollx_table != NULL)
-					sx = (x + cur_map->scrollx_table[(y * cur_map->scroll_rows) / scrymod] - cur_map->xoffset) % scrxmod;
-				else
-					sx = (x + cur_map->scrolly - cur_map->xoffset) % scrxmod;
+			INT32 sx;
+			if (map->scrollx_table != NULL)
+				sx = (x + map->scrollx_table[(y * map->scroll_rows) / scrymod] - map->xoffset) % scrxmod;
+			else
+				sx = (x + map->scrolly - map->xoffset) % scrxmod;
 
-				INT32 sy = (y + cur_map->scrolly_table[(sx * cur_map->scroll_cols) / scrxmod] - cur_map->yoffset) % scrymod;
+			INT32 sy = (y + map->scrolly_table[(sx * map->scroll_cols) / scrxmod] - map->yoffset) % scrymod;
 
-				INT32 row = sy / cur_map->theight;
-				INT32 col = sx / cur_map->twidth;
+			INT32 row = sy / map->theight;
+			INT32 col = sx / map->twidth;
 
-				INT32 by = sy;
-				if (cur_map->flags & TMAP_FLIPY) {
-					by = (bitmap_width - cur_map->theight) - by;
-				}
+			INT32 by = sy;
+			if (map->flags & TMAP_FLIPY) {
+				by = (bitmap_width - map->theight) - by;
+			}
 
-				INT32 bx = sx;
-				if (cur_map->flags & TMAP_FLIPX) {
-					bx = (bitmap_width - cur_map->twidth) - bx;
-				}
+			INT32 bx = sx;
+			if (map->flags & TMAP_FLIPX) {
+				bx = (bitmap_width - map->twidth) - bx;
+			}
 
-				INT32 code, color, group, gfxnum, category = 0, offset = cur_map->pScan(col,row);
-				UINT32 flags;
+			INT32 code, color, group, gfxnum, category = 0, offset = map->pScan(col,row);
+			UINT32 flags;
 
-				if (cur_map->dirty_tiles_enable) {
-					if (cur_map->dirty_tiles[offset] == 0) continue;
-					cur_map->dirty_tiles[offset] = 0;
-				}
+			if (map->dirty_tiles_enable) {
+				if (map->dirty_tiles[offset] == 0) continue;
+				map->dirty_tiles[offset] = 0;
+			}
 
-				cur_map->pTile(offset, &gfxnum, &code, &color, &flags, &category);
+			map->pTile(offset, &gfxnum, &code, &color, &flags, &category);
 
-				category |= category_or;
-				
-				if (category && (cur_map->flags & TMAP_TRANSMASK)) {
-					if (cur_map->transparent[category] == NULL) {
-						category = 0;
-					}
+			category |= category_or;
+			
+			if (category && (map->flags & TMAP_TRANSMASK)) {
+				if (map->transparent[category] == NULL) {
+					category = 0;
 				}
+			}
 
-				if (opaque == 0)
-				{
-					if (flags & TILE_SKIP) continue; // skip this tile
+			if (opaque == 0)
+			{
+				if (flags & TILE_SKIP) continue; // skip this tile
 
-					if (flags & TILE_GROUP_ENABLE) {
-						group = (flags >> 16) & 0xff;
+				if (flags & TILE_GROUP_ENABLE) {
+					group = (flags >> 16) & 0xff;
 
-						if (group != tgroup) {
-							continue;
-						}
+					if (group != tgroup) {
+						continue;
 					}
 				}
+			}
 
-				GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
+			GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
 
-				if (gfx->gfxbase == NULL) {
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, gfxnum);
-					continue;
-				}
+			if (gfx->gfxbase == NULL) {
+				bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, gfxnum);
+				continue;
+			}
 
-				color = ((color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
-				code %= gfx->code_mask;
+			color = ((color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+			code %= gfx->code_mask;
 
-				INT32 flipx = flags & TILE_FLIPX; 
-				INT32 flipy = flags & TILE_FLIPY;
-				if (cur_map->flags & TMAP_FLIPY) flipy ^= TILE_FLIPY;
-				if (cur_map->flags & TMAP_FLIPX) flipy ^= TILE_FLIPX;
+			INT32 flipx = flags & TILE_FLIPX; 
+			INT32 flipy = flags & TILE_FLIPY;
+			if (map->flags & TMAP_FLIPY) flipy ^= TILE_FLIPY;
+			if (map->flags & TMAP_FLIPX) flipy ^= TILE_FLIPX;
 
-				INT32 goffs = 0;
-				if (flipy) { goffs += (cur_map->theight - 1) - (sy % cur_map->theight); } else { goffs += (sy % cur_map->theight); }
-				goffs *= cur_map->twidth;
-				if (flipx) { goffs += (cur_map->twidth  - 1) - (sx % cur_map->twidth);  } else { goffs += (sx % cur_map->twidth); }
+			INT32 goffs = 0;
+			if (flipy) { goffs += (map->theight - 1) - (sy % map->theight); } else { goffs += (sy % map->theight); }
+			goffs *= map->twidth;
+			if (flipx) { goffs += (map->twidth  - 1) - (sx % map->twidth);  } else { goffs += (sx % map->twidth); }
 
-				UINT8 *gfxsrc = gfx->gfxbase + (code * cur_map->twidth * cur_map->theight) + goffs;
+			UINT8 *gfxsrc = gfx->gfxbase + (code * map->twidth * map->theight) + goffs;
 
-				UINT8 *trans_ptr = cur_map->transparent[category];
+			UINT8 *trans_ptr = map->transparent[category];
 
-				if (trans_ptr[*gfxsrc] == 0)
-				{
-					Bitmap[y * bitmap_width + x] = *gfxsrc + color;
-					pPrioDraw[y * bitmap_width + x] = priority;
-				}
+			if (trans_ptr[*gfxsrc] == 0)
+			{
+				Bitmap[y * bitmap_width + x] = *gfxsrc + color;
+				pPrioDraw[y * bitmap_width + x] = priority;
 			}
 		}
-		
-		return;
 	}
-	// line scroll
-	else if ((cur_map->scrollx_table != NULL) && (cur_map->scroll_rows > cur_map->mheight))
-	{
-		INT32 bitmap_width = maxx - minx;
-		UINT16 *dest = Bitmap;
-		UINT8 *prio = pPrioDraw;
+}
 
-		for (INT32 y = miny; y < maxy; y++, prio += bitmap_width) // line by line
-		{
-			INT32 scrolly = (cur_map->scrolly + y + cur_map->yoffset) % (cur_map->mheight * cur_map->theight);
+// line scroll, lines y0 to y1 - 1
+static void GenericTilemapDrawLineScrollLines(const GenericTilemapDrawParams *p, INT32 y0, INT32 y1)
+{
+	GenericTilemap *map = p->map;
+	UINT16 *Bitmap = p->Bitmap;
+	INT32 which = p->which, priority = p->priority, category_or = p->category_or, opaque = p->opaque, tgroup = p->tgroup;
+	INT32 minx = p->minx, maxx = p->maxx, miny = p->miny, maxy = p->maxy;
 
-			INT32 scrollx = cur_map->scrollx_table[(scrolly * cur_map->scroll_rows) / (cur_map->mheight * cur_map->theight)] - cur_map->xoffset;
+	INT32 bitmap_width = maxx - minx;
+	UINT16 *dest = Bitmap;
+	UINT8 *prio = pPrioDraw;
 
-			scrollx %= (cur_map->twidth * cur_map->mwidth);
+	for (INT32 y = y0; y < y1; y++, prio += bitmap_width) // line by line
+	{
+		INT32 scrolly = (map->scrolly + y + map->yoffset) % (map->mheight * map->theight);
 
-			INT32 row = scrolly / cur_map->theight;
+		INT32 scrollx = map->scrollx_table[(scrolly * map->scroll_rows) / (map->mheight * map->theight)] - map->xoffset;
 
-			INT32 scry = scrolly % (cur_map->theight);
-			INT32 scrx = scrollx % (cur_map->twidth);
+		scrollx %= (map->twidth * map->mwidth);
 
-			INT32 sy = y;
-			if (cur_map->flags & TMAP_FLIPY) {
-				sy = ((maxy - miny) - cur_map->theight) - sy;
-			}
+		INT32 row = scrolly / map->theight;
 
-			dest = Bitmap + sy * nScreenWidth;
-			prio = pPrioDraw + sy * nScreenWidth;
+		INT32 scry = scrolly % (map->theight);
+		INT32 scrx = scrollx % (map->twidth);
 
-			for (UINT32 x = 0; x < bitmap_width + cur_map->twidth; x+=cur_map->twidth)
-			{
-				INT32 sx = x;
-				INT32 col = ((x + scrollx) % (cur_map->mwidth * cur_map->twidth)) / cur_map->twidth;
+		INT32 sy = y;
+		if (map->flags & TMAP_FLIPY) {
+			sy = ((maxy - miny) - map->theight) - sy;
+		}
 
-				INT32 code, color, group, gfxnum, category = 0, offset = cur_map->pScan(col,row);
-				UINT32 flags;
+		dest = Bitmap + sy * nScreenWidth;
+		prio = pPrioDraw + sy * nScreenWidth;
 
-				if (cur_map->dirty_tiles_enable) {
-					if (cur_map->dirty_tiles[offset] == 0) continue;
-					cur_map->dirty_tiles[offset] = 0;
-				}
+		for (UINT32 x = 0; x < bitmap_width + map->twidth; x+=map->twidth)
+		{
+			INT32 sx = x;
+			INT32 col = ((x + scrollx) % (map->mwidth * map->twidth)) / map->twidth;
 
-				cur_map->pTile(offset, &gfxnum, &code, &color, &flags, &category);
+			INT32 code, color, group, gfxnum, category = 0, offset = map->pScan(col,row);
+			UINT32 flags;
 
-				category |= category_or;
-				
-				if (category && (cur_map->flags & TMAP_TRANSMASK)) {
-					if (cur_map->transparent[category] == NULL) {
-						category = 0;
-					}
+			if (map->dirty_tiles_enable) {
+				if (map->dirty_tiles[offset] == 0) continue;
+				map->dirty_tiles[offset] = 0;
+			}
+
+			map->pTile(offset, &gfxnum, &code, &color, &flags, &category);
+
+			category |= category_or;
+			
+			if (category && (map->flags & TMAP_TRANSMASK)) {
+				if (map->transparent[category] == NULL) {
+					category = 0;
 				}
+			}
 
-				if (opaque == 0)
-				{
-					if (flags & TILE_SKIP) continue; // skip this tile
+			if (opaque == 0)
+			{
+				if (flags & TILE_SKIP) continue; // skip this tile
 
-					if (flags & TILE_GROUP_ENABLE) {
-						group = (flags >> 16) & 0xff;
+				if (flags & TILE_GROUP_ENABLE) {
+					group = (flags >> 16) & 0xff;
 
-						if (group != tgroup) {
-							continue;
-						}
+					if (group != tgroup) {
+						continue;
 					}
 				}
+			}
 
-				GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
+			GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
 
-				if (gfx->gfxbase == NULL) {
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, gfxnum);
-					continue;
-				}
+			if (gfx->gfxbase == NULL) {
+				bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, gfxnum);
+				continue;
+			}
 
-				color = ((color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
-				code %= gfx->code_mask;
+			color = ((color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+			code %= gfx->code_mask;
 
-				INT32 flipx = flags & TILE_FLIPX; 
-				INT32 flipy = flags & TILE_FLIPY;
+			INT32 flipx = flags & TILE_FLIPX; 
+			INT32 flipy = flags & TILE_FLIPY;
 
-				if (cur_map->flags & TMAP_FLIPY) {
-					flipy ^= TILE_FLIPY;
-				}
+			if (map->flags & TMAP_FLIPY) {
+				flipy ^= TILE_FLIPY;
+			}
 
-				INT32 scy;
-				if (flipy)
-					scy = (cur_map->theight - 1) - scry;
-				else
-					scy = scry;
+			INT32 scy;
+			if (flipy)
+				scy = (map->theight - 1) - scry;
+			else
+				scy = scry;
 
-				if (cur_map->flags & TMAP_FLIPX) {
-					sx = ((maxx - minx) - cur_map->twidth) - sx;
-					scrx = ((cur_map->twidth) - 1) - scrx;
-					flipx ^= TILE_FLIPX;
-				}
+			if (map->flags & TMAP_FLIPX) {
+				sx = ((maxx - minx) - map->twidth) - sx;
+				scrx = ((map->twidth) - 1) - scrx;
+				flipx ^= TILE_FLIPX;
+			}
 
-				UINT8 *gfxsrc = gfx->gfxbase + (code * cur_map->twidth * cur_map->theight) + (scy * cur_map->twidth);
-				UINT8 *trans_ptr = cur_map->transparent[category];
+			UINT8 *gfxsrc = gfx->gfxbase + (code * map->twidth * map->theight) + (scy * map->twidth);
+			UINT8 *trans_ptr = map->transparent[category];
 
-				if (flipx)
-				{
-					INT32 flip_wide = cur_map->twidth - 1;
+			if (flipx)
+			{
+				INT32 flip_wide = map->twidth - 1;
 
-					for (UINT32 dx = 0; dx < cur_map->twidth; dx++)
-					{
-						INT32 dst = (sx + dx) - scrx;
-						if (dst < minx || dst >= maxx) continue;
+				for (UINT32 dx = 0; dx < map->twidth; dx++)
+				{
+					INT32 dst = (sx + dx) - scrx;
+					if (dst < minx || dst >= maxx) continue;
 
-						if (trans_ptr[gfxsrc[flip_wide - dx]] == 0) {
-							dest[dst] = color + gfxsrc[flip_wide - dx];
-							prio[dst] = priority;
-						}
+					if (trans_ptr[gfxsrc[flip_wide - dx]] == 0) {
+						dest[dst] = color + gfxsrc[flip_wide - dx];
+						prio[dst] = priority;
 					}
 				}
-				else
+			}
+			else
+			{
+				for (UINT32 dx = 0; dx < map->twidth; dx++)
 				{
-					for (UINT32 dx = 0; dx < cur_map->twidth; dx++)
-					{
-						INT32 dst = (sx + dx) - scrx;
-						if (dst < minx || dst >= maxx) continue;
+					INT32 dst = (sx + dx) - scrx;
+					if (dst < minx || dst >= maxx) continue;
 
-						if (cur_map->transparent[0][gfxsrc[dx]] == 0) {
-							dest[dst] = color + gfxsrc[dx];
-							prio[dst] = priority;
-						}
+					if (map->transparent[0][gfxsrc[dx]] == 0) {
+						dest[dst] = color + gfxsrc[dx];
+						prio[dst] = priority;
 					}
 				}
 			}
 		}
+	}
+}
+
+static void GenericTilemapDrawBand(void *pParam, INT32 nBand)
+{
+	const GenericTilemapDrawParams *p = (const GenericTilemapDrawParams*)pParam;
+
+	INT32 nLines = p->maxy - p->miny;
+	INT32 y0 = p->miny + (nLines * nBand) / p->nBands;
+	INT32 y1 = p->miny + (nLines * (nBand + 1)) / p->nBands;
+
+	p->pDrawLines(p, y0, y1);
+}
+
+// Every line of these modes is drawn on its own, so bands of lines can be drawn by different threads
+// with the same result. Dirty tiles are cleared while drawing, so those maps are always drawn here.
+static void GenericTilemapDrawLines(GenericTilemapDrawParams *p)
+{
+	INT32 nLines = p->maxy - p->miny;
+
+	if (bGenericTilemapThreads && BurnThreadRun && nBurnThreads > 1 && !p->map->dirty_tiles_enable && nLines >= nBurnThreads * 8) {
+		p->nBands = nBurnThreads;
+		BurnThreadRun(GenericTilemapDrawBand, p, p->nBands);
+	} else {
+		p->pDrawLines(p, p->miny, p->maxy);
+	}
+}
+
+void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority)
+{
+#if defined FBA_DEBUG
+	if (Bitmap == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized Bitmap!\n"), which, priority);
+		return;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+#if defined FBA_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized tilemap!\n"), which, priority);
+		return;
+	}
+#endif
 
+	if (cur_map->enable == 0) { // layer disabled!
+		return;
+	}
+
+	INT32 minx, maxx, miny, maxy;
+	GenericTilesGetClip(&minx, &maxx, &miny, &maxy);
+
+	// check clipping and fix clipping sizes if out of bounds
+	if (minx < 0 || maxx > nScreenWidth || miny < 0 || maxy > nScreenHeight) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d) called with improper clipping values (%d, %d, %d, %d)!"), which, priority, minx, maxx, miny, maxy);
+		bprintf (PRINT_ERROR, _T("pPrioDraw is %d pixels wide and %d pixels high!\n"), nScreenWidth, nScreenHeight);
+
+		if (minx < 0) minx = 0;
+		if (maxx >= nScreenWidth) maxx = nScreenWidth;
+		if (miny < 0) miny = 0;
+		if (maxy >= nScreenHeight) maxy = nScreenHeight;
+	}
+
+	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
+	INT32 opaque = priority & TMAP_FORCEOPAQUE;
+	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
+	INT32 tgroup = (priority >> 8) & 0xff;
+	priority &= 0xff;
+
+	GenericTilemapDrawParams params;
+	params.map = cur_map;
+	params.which = which;
+	params.Bitmap = Bitmap;
+	params.priority = priority;
+	params.category_or = category_or;
+	params.opaque = opaque;
+	params.tgroup = tgroup;
+	params.minx = minx;
+	params.maxx = maxx;
+	params.miny = miny;
+	params.maxy = maxy;
+
+	// column (less than tile size) and line scroll
+	if ((cur_map->scrolly_table != NULL) && (cur_map->scroll_cols > cur_map->mwidth))
+	{
+		params.pDrawLines = GenericTilemapDrawColScrollLines;
+		GenericTilemapDrawLines(&params);
+		return;
+	}
+	// line scroll
+	else if ((cur_map->scrollx_table != NULL) && (cur_map->scroll_rows > cur_map->mheight))
+	{
+		params.pDrawLines = GenericTilemapDrawLineScrollLines;
+		GenericTilemapDrawLines(&params);
 		return;
 	}
 	// scrollx and scrolly
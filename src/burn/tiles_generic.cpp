@@ -171,6 +171,359 @@ void BurnTransferClear(UINT16 nFillPattern)
 	}
 }
 
+/*================================================================================================
+Transfer kernels - convert one line of pTransDraw through the palette
+
+The scalar versions are always available, the others are picked by BurnTransferSelectKernels().
+None of the targets have a fast enough byte gather for 16 bit indexes, so the SSE2 and NEON
+versions look up the colours one by one and only vectorise the stores; AVX2 uses a real gather.
+================================================================================================*/
+
+typedef void (*BurnTransferLineFn)(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth);
+
+static void BurnTransferLine16_C(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+
+	for (INT32 x = 0; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+static void BurnTransferLine24_C(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	INT32 x = 0;
+
+#ifdef LSB_FIRST
+	// 4 pixels make 3 whole words
+	for (; x < (nWidth & ~3); x += 4, pDest += 12) {
+		UINT32 c0 = pPalette[pSrc[x + 0]] & 0xffffff;
+		UINT32 c1 = pPalette[pSrc[x + 1]] & 0xffffff;
+		UINT32 c2 = pPalette[pSrc[x + 2]] & 0xffffff;
+		UINT32 c3 = pPalette[pSrc[x + 3]] & 0xffffff;
+
+		UINT32 w0 = c0 | (c1 << 24);
+		UINT32 w1 = (c1 >> 8) | (c2 << 16);
+		UINT32 w2 = (c2 >> 16) | (c3 << 8);
+
+		memcpy(pDest + 0, &w0, 4);
+		memcpy(pDest + 4, &w1, 4);
+		memcpy(pDest + 8, &w2, 4);
+	}
+#endif
+
+	for (; x < nWidth; x++, pDest += 3) {
+		UINT32 c = pPalette[pSrc[x]];
+		pDest[0] = c & 0xFF;
+		pDest[1] = (c >> 8) & 0xFF;
+		pDest[2] = c >> 16;
+	}
+}
+
+static void BurnTransferLine32_C(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+
+	for (INT32 x = 0; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_TRANSFER_SSE2
+ #include <emmintrin.h>
+
+static void BurnTransferLine16_SSE2(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~7); x += 8) {
+		__m128i c = _mm_set_epi16(pPalette[pSrc[x + 7]], pPalette[pSrc[x + 6]], pPalette[pSrc[x + 5]], pPalette[pSrc[x + 4]],
+								  pPalette[pSrc[x + 3]], pPalette[pSrc[x + 2]], pPalette[pSrc[x + 1]], pPalette[pSrc[x + 0]]);
+		_mm_storeu_si128((__m128i*)(pDest16 + x), c);
+	}
+
+	for (; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+static void BurnTransferLine32_SSE2(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~3); x += 4) {
+		__m128i c = _mm_set_epi32(pPalette[pSrc[x + 3]], pPalette[pSrc[x + 2]], pPalette[pSrc[x + 1]], pPalette[pSrc[x + 0]]);
+		_mm_storeu_si128((__m128i*)(pDest32 + x), c);
+	}
+
+	for (; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+#endif
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__)) && (defined (__clang__) || __GNUC__ >= 5)
+ #define BURN_TRANSFER_AVX2
+ #include <immintrin.h>
+
+__attribute__((target("avx2"))) static void BurnTransferLine16_AVX2(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+	const __m256i nMask = _mm256_set1_epi32(0xffff);
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~15); x += 16) {
+		__m256i i0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x + 0)));
+		__m256i i1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x + 8)));
+		__m256i c0 = _mm256_and_si256(_mm256_i32gather_epi32((const int*)pPalette, i0, 4), nMask);
+		__m256i c1 = _mm256_and_si256(_mm256_i32gather_epi32((const int*)pPalette, i1, 4), nMask);
+
+		// packus works within each 128-bit lane, put the quarters back in order
+		__m256i c = _mm256_permute4x64_epi64(_mm256_packus_epi32(c0, c1), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256((__m256i*)(pDest16 + x), c);
+	}
+
+	for (; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+__attribute__((target("avx2"))) static void BurnTransferLine32_AVX2(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~7); x += 8) {
+		__m256i i = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x)));
+		_mm256_storeu_si256((__m256i*)(pDest32 + x), _mm256_i32gather_epi32((const int*)pPalette, i, 4));
+	}
+
+	for (; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+#endif
+
+#if defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_TRANSFER_NEON
+ #include <arm_neon.h>
+
+static inline uint32x4_t BurnTransferLookup4_NEON(const UINT16* pSrc, const UINT32* pPalette)
+{
+	uint32x4_t c = vdupq_n_u32(pPalette[pSrc[0]]);
+	c = vsetq_lane_u32(pPalette[pSrc[1]], c, 1);
+	c = vsetq_lane_u32(pPalette[pSrc[2]], c, 2);
+	c = vsetq_lane_u32(pPalette[pSrc[3]], c, 3);
+
+	return c;
+}
+
+static void BurnTransferLine16_NEON(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~7); x += 8) {
+		uint16x4_t c0 = vmovn_u32(BurnTransferLookup4_NEON(pSrc + x + 0, pPalette));
+		uint16x4_t c1 = vmovn_u32(BurnTransferLookup4_NEON(pSrc + x + 4, pPalette));
+		vst1q_u16(pDest16 + x, vcombine_u16(c0, c1));
+	}
+
+	for (; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+static void BurnTransferLine32_NEON(UINT8* pDest, const UINT16* pSrc, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+	INT32 x = 0;
+
+	for (; x < (nWidth & ~3); x += 4) {
+		vst1q_u32(pDest32 + x, BurnTransferLookup4_NEON(pSrc + x, pPalette));
+	}
+
+	for (; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+#endif
+
+// Indexed by nBurnBpp
+static BurnTransferLineFn BurnTransferLine[5] = { NULL, NULL, BurnTransferLine16_C, BurnTransferLine24_C, BurnTransferLine32_C };
+
+static void BurnTransferSelectKernels()
+{
+	BurnTransferLine[2] = BurnTransferLine16_C;
+	BurnTransferLine[4] = BurnTransferLine32_C;
+
+#if defined BURN_TRANSFER_SSE2
+	BurnTransferLine[2] = BurnTransferLine16_SSE2;
+	BurnTransferLine[4] = BurnTransferLine32_SSE2;
+#endif
+
+#if defined BURN_TRANSFER_AVX2
+	if (bBurnUseAVX2) {
+		BurnTransferLine[2] = BurnTransferLine16_AVX2;
+		BurnTransferLine[4] = BurnTransferLine32_AVX2;
+	}
+#endif
+
+#if defined BURN_TRANSFER_NEON
+	BurnTransferLine[2] = BurnTransferLine16_NEON;
+	BurnTransferLine[4] = BurnTransferLine32_NEON;
+#endif
+}
+
+/*================================================================================================
+Unchanged line skipping - when bBurnTransferSkipRows is set, lines whose pens and palette colours are
+the same as in the last copy are not converted again.
+Some drivers (and the gun/led overlays) draw straight into pBurnDraw, so a copy of the converted lines
+is kept as well and a line is only skipped if pBurnDraw still holds exactly what was written to it.
+================================================================================================*/
+
+bool bBurnTransferSkipRows = false;
+
+static UINT16* pTransShadow = NULL;				// pens of the last copy
+static UINT8* pTransDestShadow = NULL;			// pixels written by the last copy
+static UINT32* pTransPalShadow = NULL;			// palette of the last copy, up to nTransMaxPen
+static bool bTransShadowValid = false;
+static INT32 nTransMaxPen = 0;
+static UINT8* pTransLastDest = NULL;
+static UINT32* pTransLastPalette = NULL;
+static INT32 nTransLastPitch = 0;
+static INT32 nTransLastBpp = 0;
+
+static UINT32 nTransLastFrame = ~0U;
+static INT32 nTransChangedRows = 0;
+
+static UINT64 nTransStatRows = 0;
+static UINT64 nTransStatSkipped = 0;
+static UINT32 nTransStatFrames = 0;
+static UINT32 nTransStatUnchanged = 0;
+
+static void BurnTransferFreeShadow()
+{
+	if (pTransShadow) free(pTransShadow);
+	if (pTransDestShadow) free(pTransDestShadow);
+	if (pTransPalShadow) free(pTransPalShadow);
+	pTransShadow = NULL;
+	pTransDestShadow = NULL;
+	pTransPalShadow = NULL;
+	bTransShadowValid = false;
+}
+
+static void BurnTransferResetShadow()
+{
+	BurnTransferFreeShadow();
+
+	nTransMaxPen = 0;
+	nTransLastFrame = ~0U;
+	nTransStatRows = nTransStatSkipped = 0;
+	nTransStatFrames = nTransStatUnchanged = 0;
+}
+
+// True when no line of pBurnDraw changed in this frame: everything was skipped by BurnTransferCopy()
+// and nothing was drawn over it afterwards
+bool BurnTransferFrameUnchanged()
+{
+	if (!bBurnTransferSkipRows || !bTransShadowValid || nTransLastFrame != nCurrentFrame || nTransChangedRows) {
+		return false;
+	}
+
+	INT32 nRowLen = nTransWidth * nTransLastBpp;
+
+	for (INT32 y = 0; y < nTransHeight; y++) {
+		if (memcmp(pTransLastDest + y * nTransLastPitch, pTransDestShadow + y * nRowLen, nRowLen)) {
+			return false;
+		}
+	}
+
+	nTransStatUnchanged++;
+
+	return true;
+}
+
+void BurnTransferGetStats(UINT64* pnRows, UINT64* pnSkipped, UINT32* pnFrames, UINT32* pnUnchanged)
+{
+	*pnRows = nTransStatRows;
+	*pnSkipped = nTransStatSkipped;
+	*pnFrames = nTransStatFrames;
+	*pnUnchanged = nTransStatUnchanged;
+}
+
+static bool BurnTransferCopySkipRows(UINT32* pPalette, BurnTransferLineFn pLine)
+{
+	UINT16* pSrc = pTransDraw;
+	UINT8* pDest = pBurnDraw;
+	INT32 nRowLen = nTransWidth * nBurnBpp;
+
+	if (pTransShadow == NULL) {
+		// not BurnMalloc(), the shadow has to survive drivers which don't call BurnTransferExit()
+		pTransShadow = (UINT16*)malloc(nTransWidth * nTransHeight * sizeof(UINT16));
+		pTransDestShadow = (UINT8*)malloc(nTransWidth * nTransHeight * 4);
+		pTransPalShadow = (UINT32*)malloc(0x10000 * sizeof(UINT32));
+
+		if (pTransShadow == NULL || pTransDestShadow == NULL || pTransPalShadow == NULL) {
+			BurnTransferFreeShadow();
+			return false;
+		}
+	}
+
+	bool bFull = !bTransShadowValid || pDest != pTransLastDest || pPalette != pTransLastPalette || nBurnPitch != nTransLastPitch || nBurnBpp != nTransLastBpp;
+
+	if (!bFull && memcmp(pPalette, pTransPalShadow, (nTransMaxPen + 1) * sizeof(UINT32))) {
+		bFull = true;
+	}
+
+	INT32 nOldMaxPen = nTransMaxPen;
+	INT32 nChanged = 0;
+	UINT16* pShadow = pTransShadow;
+	UINT8* pDestShadow = pTransDestShadow;
+
+	for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch, pShadow += nTransWidth, pDestShadow += nRowLen) {
+		if (!bFull && memcmp(pSrc, pShadow, nTransWidth * sizeof(UINT16)) == 0 && memcmp(pDest, pDestShadow, nRowLen) == 0) {
+			continue;
+		}
+
+		pLine(pDest, pSrc, pPalette, nTransWidth);
+		memcpy(pShadow, pSrc, nTransWidth * sizeof(UINT16));
+		memcpy(pDestShadow, pDest, nRowLen);
+
+		for (INT32 x = 0; x < nTransWidth; x++) {
+			if (pSrc[x] > nTransMaxPen) nTransMaxPen = pSrc[x];
+		}
+
+		nChanged++;
+	}
+
+	if (bFull || nTransMaxPen != nOldMaxPen) {
+		memcpy(pTransPalShadow, pPalette, (nTransMaxPen + 1) * sizeof(UINT32));
+	}
+
+	bTransShadowValid = true;
+	pTransLastDest = pBurnDraw;
+	pTransLastPalette = pPalette;
+	nTransLastPitch = nBurnPitch;
+	nTransLastBpp = nBurnBpp;
+
+	// more than one copy in a frame adds up
+	if (nTransLastFrame != nCurrentFrame) {
+		nTransLastFrame = nCurrentFrame;
+		nTransChangedRows = 0;
+		nTransStatFrames++;
+	}
+	nTransChangedRows += nChanged;
+
+	nTransStatRows += nTransHeight;
+	nTransStatSkipped += nTransHeight - nChanged;
+
+	return true;
+}
+
 INT32 BurnTransferCopy(UINT32* pPalette)
 {
 #if defined FBA_DEBUG
@@ -182,35 +535,20 @@ INT32 BurnTransferCopy(UINT32* pPalette)
 
 	pBurnDrvPalette = pPalette;
 
-	switch (nBurnBpp) {
-		case 2: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x ++) {
-					((UINT16*)pDest)[x] = pPalette[pSrc[x]];
-				}
-			}
-			break;
-		}
-		case 3: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x++) {
-					UINT32 c = pPalette[pSrc[x]];
-					*(pDest + (x * 3) + 0) = c & 0xFF;
-					*(pDest + (x * 3) + 1) = (c >> 8) & 0xFF;
-					*(pDest + (x * 3) + 2) = c >> 16;
+	if (nBurnBpp < 2 || nBurnBpp > 4) {
+		return 0;
+	}
 
-				}
-			}
-			break;
-		}
-		case 4: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x++) {
-					((UINT32*)pDest)[x] = pPalette[pSrc[x]];
-				}
-			}
-			break;
-		}
+	BurnTransferLineFn pLine = BurnTransferLine[nBurnBpp];
+
+	if (bBurnTransferSkipRows && BurnTransferCopySkipRows(pPalette, pLine)) {
+		return 0;
+	}
+
+	bTransShadowValid = false;
+
+	for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
+		pLine(pDest, pSrc, pPalette, nTransWidth);
 	}
 
 	return 0;
@@ -225,6 +563,8 @@ void BurnTransferExit()
 	BurnBitmapExit();
 	pTransDraw = NULL;
 	pPrioDraw = NULL;
+
+	BurnTransferFreeShadow();
 //	BurnFree(pTransDraw);
 //	BurnFree(pPrioDraw);
 
@@ -248,8 +588,12 @@ INT32 BurnTransferInit()
 	pTransDraw = BurnBitmapGetBitmap(0);
 	pPrioDraw = BurnBitmapGetPriomap(0);
 
+	BurnTransferSelectKernels();
 	BurnTransferClear();
 
+	// the size may have changed
+	BurnTransferResetShadow();
+
 	return 0;
 }
 
@@ -312,225 +656,136 @@ void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT
 
 //================================================================================================
 
-#define PLOTPIXEL_PRIO(x) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority; }
-#define PLOTPIXEL_PRIO_FLIPX(x, a) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority; }
-#define PLOTPIXEL_PRIO_MASK(x, mc) if (pTileData[x] != mc) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority; }
-#define PLOTPIXEL_PRIO_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority; }
-
-#define PLOTPIXEL(x) pPixel[x] = nPalette + pTileData[x];
-#define PLOTPIXEL_FLIPX(x, a) pPixel[x] = nPalette + pTileData[a];
-#define PLOTPIXEL_MASK(x, mc) if (pTileData[x] != mc) {pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) {pPixel[x] = nPalette + pTileData[a] ;}
-
-#define PLOTPIXEL_PRIO_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority; }
-#define PLOTPIXEL_PRIO_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority; }
-#define PLOTPIXEL_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a] ;}
-
-#define CLIPPIXEL(x, sx, a) if ((sx + x) >= nScreenWidthMin && (sx + x) < nScreenWidthMax) { a; };
-
-/*================================================================================================
-8 x 8 Functions
-================================================================================================*/
-
-void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
+// Every Render*Tile function below is a specialisation of RenderTile(), so they all draw alike and
+// there is one place to optimise. nW and nH are the tile size (0 for the Custom functions).
+
+#define RENDER_OPAQUE		0
+#define RENDER_MASK		1		// pixels of colour nMaskColour are transparent
+#define RENDER_TRANSMASK	2		// pixels with a non-zero pTransTable entry are transparent
+
+// Draws pixels x to nEndX - 1 of a tile line
+template <INT32 nMode, INT32 bFlipX, INT32 bPrio>
+static inline void RenderTileLine(UINT16* pPixel, UINT8* pPri, const UINT8* pSrc, INT32 nWidth, INT32 x, INT32 nEndX, UINT32 nPalette, INT32 nMaskColour, const UINT8* pTransTable, INT32 nPriority)
+{
+#if defined BURN_TRANSFER_SSE2
+	if (nMode != RENDER_TRANSMASK) {
+		const __m128i vZero = _mm_setzero_si128();
+		const __m128i vPalette = _mm_set1_epi16((INT16)nPalette);
+		const __m128i vPriority = _mm_set1_epi8((char)nPriority);
+		// a mask colour out of the 0 - 255 range never matches
+		const __m128i vMask = _mm_set1_epi16((nMaskColour & ~0xff) ? -1 : nMaskColour);
+
+		for (; x + 8 <= nEndX; x += 8) {
+			__m128i vSrc = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pSrc + (bFlipX ? (nWidth - 8 - x) : x))), vZero);
+			if (bFlipX) {
+				vSrc = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(vSrc, 0x1b), 0x1b), 0x4e);
+			}
+			__m128i vPixel = _mm_add_epi16(vSrc, vPalette);
+
+			if (nMode == RENDER_OPAQUE) {
+				_mm_storeu_si128((__m128i*)(pPixel + x), vPixel);
+				if (bPrio) _mm_storel_epi64((__m128i*)(pPri + x), vPriority);
+			} else {
+				__m128i vSkip = _mm_cmpeq_epi16(vSrc, vMask);
+				if (_mm_movemask_epi8(vSkip) == 0xffff) continue;
+
+				__m128i vDest = _mm_loadu_si128((const __m128i*)(pPixel + x));
+				_mm_storeu_si128((__m128i*)(pPixel + x), _mm_or_si128(_mm_and_si128(vSkip, vDest), _mm_andnot_si128(vSkip, vPixel)));
+				if (bPrio) {
+					__m128i vSkip8 = _mm_packs_epi16(vSkip, vSkip);
+					__m128i vPri = _mm_loadl_epi64((const __m128i*)(pPri + x));
+					_mm_storel_epi64((__m128i*)(pPri + x), _mm_or_si128(_mm_and_si128(vSkip8, vPri), _mm_andnot_si128(vSkip8, vPriority)));
+				}
+			}
+		}
+	}
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	for (; x < nEndX; x++) {
+		INT32 nColour = pSrc[bFlipX ? (nWidth - 1 - x) : x];
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+		if (nMode == RENDER_MASK && nColour == nMaskColour) continue;
+		if (nMode == RENDER_TRANSMASK && pTransTable[nColour]) continue;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
+		pPixel[x] = nPalette + nColour;
+		if (bPrio) pPri[x] = nPriority;
 	}
 }
 
-void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+template <INT32 nW, INT32 nH, INT32 nMode, INT32 bFlipX, INT32 bFlipY, INT32 bClip, INT32 bPrio>
+static inline void RenderTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, UINT32 nPalette, INT32 nMaskColour, UINT8* pTransTable, INT32 nPriority, UINT8* pTile)
 {
+	if (nW) {
+		nWidth = nW;
+		nHeight = nH;
+	}
+
 #if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Clip called without init\n"));
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render%dx%dTile called without init\n"), nWidth, nHeight);
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	const UINT8* pSrc = pTile + (nTileNumber * nWidth * nHeight);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+	INT32 x0 = 0, x1 = nWidth, y0 = 0, y1 = nHeight;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	if (bClip) {
+		if (StartX + x0 < nScreenWidthMin) x0 = nScreenWidthMin - StartX;
+		if (StartX + x1 > nScreenWidthMax) x1 = nScreenWidthMax - StartX;
+		if (StartY + y0 < nScreenHeightMin) y0 = nScreenHeightMin - StartY;
+		if (StartY + y1 > nScreenHeightMax) y1 = nScreenHeightMax - StartY;
 
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
+		if (x0 >= x1 || y0 >= y1) return;
 	}
-}
-
-void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX called without init\n"));
-#endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	for (INT32 y = y0; y < y1; y++) {
+		INT32 nOffset = ((StartY + y) * nScreenWidth) + StartX;
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
+		RenderTileLine<nMode, bFlipX, bPrio>(pDestDraw + nOffset, bPrio ? (pPrioDraw + nOffset) : NULL, pSrc + ((bFlipY ? (nHeight - 1 - y) : y) * nWidth), nWidth, x0, x1, nPalette, nMaskColour, pTransTable, nPriority);
 	}
 }
 
-void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX_Clip called without init\n"));
-#endif
+/*================================================================================================
+8 x 8 Functions
+================================================================================================*/
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 0, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
+}
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 0, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
+}
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 0, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
+}
 
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
-	}
+void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 0, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 1, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 1, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render8x8Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 1, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 1, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -539,202 +794,42 @@ void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 
 void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 0, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 0, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
-}
+	RenderTile<8, 8, RENDER_MASK, 1, 0, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
+}
 
 void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 0, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 1, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 1, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 1, 0, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 1, 1, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -743,266 +838,42 @@ void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 
 void Render16x16Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 0, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 0, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 0, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 0, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 1, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 1, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 1, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 1, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -1011,266 +882,42 @@ void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 
 void Render16x16Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 0, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 0, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 0, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 0, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 1, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 1, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 1, 0, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 1, 1, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -1279,394 +926,42 @@ void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 
 void Render32x32Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 0, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 0, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 0, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 0, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 1, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 1, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 1, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 1, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -1675,394 +970,42 @@ void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 
 void Render32x32Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 0, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 0, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 0, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 0, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 1, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 1, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 1, 0, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 1, 1, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -2071,163 +1014,42 @@ Custom Height and Width Functions
 
 void RenderCustomTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
-}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 0, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
+}
 
 void RenderCustomTile_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) 
-   {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 0, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 0, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 0, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 1, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 1, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 1, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 void RenderCustomTile_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 1, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, 0, pTile);
 }
 
 /*================================================================================================
@@ -2236,372 +1058,84 @@ Custom Height and Width Functions with Masking
 
 void RenderCustomTile_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 0, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 0, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 0, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 0, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 1, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 1, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 1, 0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 1, 1, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, 0, pTile);
 }
 
 
 
 void Render8x8Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 0, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 0, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 0, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 0, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 1, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 0, 1, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 1, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw+ ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<8, 8, RENDER_OPAQUE, 1, 1, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -2610,210 +1144,42 @@ void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 
 void Render8x8Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 0, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 0, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 0, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 0, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 1, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 0, 1, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 1, 0, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, 8, RENDER_MASK, 1, 1, 1, 1>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -2822,274 +1188,42 @@ void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, I
 
 void Render16x16Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 0, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 0, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 0, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 0, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 1, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 0, 1, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 1, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<16, 16, RENDER_OPAQUE, 1, 1, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -3098,274 +1232,42 @@ void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 
 void Render16x16Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 0, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 0, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 0, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 0, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 1, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 0, 1, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 1, 0, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, 16, RENDER_MASK, 1, 1, 1, 1>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -3374,402 +1276,42 @@ void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 
 void Render32x32Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 0, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 0, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 0, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 0, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 1, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 0, 1, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 1, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<32, 32, RENDER_OPAQUE, 1, 1, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -3778,402 +1320,42 @@ void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 
 void Render32x32Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 0, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 0, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 0, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 0, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 1, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 0, 1, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 1, 0, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, 32, RENDER_MASK, 1, 1, 1, 1>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -4182,171 +1364,42 @@ Custom Height and Width Functions
 
 void RenderCustomTile_Prio(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 0, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_OPAQUE, 1, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, NULL, nPriority, pTile);
 }
 
 /*================================================================================================
@@ -4355,170 +1408,42 @@ Custom Height and Width Functions with Masking
 
 void RenderCustomTile_Prio_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 0, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, 0, RENDER_MASK, 1, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, nMaskColour, NULL, nPriority, pTile);
 }
 
 
@@ -4531,189 +1456,44 @@ void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT
 
 void RenderCustomTile_Prio_TransMask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 0, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 0, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 1, 0, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 1, 0, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 0, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 0, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 1, 1, 0, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBA_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, 0, RENDER_TRANSMASK, 1, 1, 1, 1>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, (nTilePalette << nColourDepth) + nPaletteOffset, 0, pTransTable, nPriority, pTile);
 }
 
-
-
-#undef PLOTPIXEL_PRIO_TRANSMASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-#undef PLOTPIXEL_TRANSMASK
-#undef PLOTPIXEL_TRANSMASK_FLIPX
-
-#undef PLOTPIXEL
-#undef PLOTPIXEL_FLIPX
-#undef PLOTPIXEL_MASK
-#undef CLIPPIXEL
-
-#undef PLOTPIXEL_PRIO
-#undef PLOTPIXEL_PRIO_FLIPX
-#undef PLOTPIXEL_PRIO_MASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-
 /*================================================================================================
 Merged tile functions (flipping/clipping merged)
 ================================================================================================*/
@@ -203,6 +203,13 @@ INT32 ZipClose();
 INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount);
 INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
+INT32 ZipPark(INT32 nSlot);
+INT32 ZipUnpark(INT32 nSlot);
+INT32 ZipCloseParked();
+struct ZipArchive* ZipArchiveOpen(char* szZip);
+INT32 ZipArchiveFind(struct ZipArchive* pArchive, const char* szName, UINT32* pnLen, UINT32* pnCrc);
+INT32 ZipArchiveLoadFile(struct ZipArchive* pArchive, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
+INT32 ZipArchiveClose(struct ZipArchive* pArchive);
 
 // bzip.cpp
 
@@ -8,11 +8,16 @@
 #include "burnint.h"
 
 #include "retro_common.h"
+#include "retro_audio.h"
 #include "retro_cdemu.h"
 #include "retro_input.h"
 #include "retro_memory.h"
+#include "retro_romcache.h"
+#include "retro_state.h"
+#include "retro_threads.h"
 
 #include <file/file_path.h>
+#include <features/features_cpu.h>
 
 #include <streams/file_stream.h>
 
@@ -80,6 +85,7 @@ struct ROMFIND
 	unsigned int nState;
 	int nArchive;
 	int nPos;
+	bool bBadCrc;
 	BurnRomInfo ri;
 };
 
@@ -87,11 +93,26 @@ static std::vector<std::string> g_find_list_path;
 static ROMFIND g_find_list[1024];
 static unsigned g_rom_count;
 
+// Archives stay open (parked in zipfn) from open_archive() until the driver is initialized
+static bool g_archive_streaming;
+static int g_archive_current = -1;
+static unsigned g_rom_load_count;
+static retro_time_t g_rom_load_time;
+
 INT32 nAudSegLen = 0;
 
 static UINT8* pVidImage = NULL;
 static int16_t *g_audio_buf;
 
+// Run-ahead: frames emulated (and rolled back) after each frame, to hide the lag of the game
+UINT32 nRunAhead = 0;
+static StateSnapshot g_runahead_state;
+static int16_t *g_runahead_audio_buf;
+static unsigned g_runahead_count;
+static retro_time_t g_runahead_time;
+
+static bool g_can_dupe;
+
 // Mapping of PC inputs to game inputs
 struct GameInp* GameInp = NULL;
 UINT32 nGameInpCount = 0;
@@ -470,53 +491,150 @@ char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, int /*nOutSize*/
 
 const int nConfigMinVersion = 0x020921;
 
-// addition to support loading of roms without crc check
-static int find_rom_by_name(char *name, const ZipEntry *list, unsigned elems)
+// Hash index from crc and name to the position of an entry in a rom list, so each lookup
+// doesn't have to scan the whole list. Like the linear scans it replaces, the first entry wins.
+struct rom_index_key
+{
+   const char *name;
+   uint32_t crc;
+};
+
+struct rom_index
+{
+   std::vector<rom_index_key> keys;
+   std::vector<int> crc_slots;
+   std::vector<int> name_slots;
+   unsigned mask;
+};
+
+static inline unsigned rom_index_hash_crc(uint32_t crc)
+{
+   return (crc ^ (crc >> 16)) * 0x9e3779b1;
+}
+
+static inline unsigned rom_index_hash_name(const char *name)
+{
+   unsigned hash = 2166136261u;
+   while (*name)
+      hash = (hash ^ (uint8_t)*name++) * 16777619u;
+   return hash;
+}
+
+static void rom_index_build(rom_index &index)
 {
-   unsigned i = 0;
-   for (i = 0; i < elems; i++)
+   unsigned size = 16;
+   while (size < index.keys.size() * 2)
+      size <<= 1;
+
+   index.mask = size - 1;
+   index.crc_slots.assign(size, -1);
+   index.name_slots.assign(size, -1);
+
+   for (unsigned i = 0; i < index.keys.size(); i++)
    {
-      if( strcmp(list[i].szName, name) == 0 )
-      {
-         return i;
-      }
+      const rom_index_key &key = index.keys[i];
+
+      unsigned slot = rom_index_hash_crc(key.crc) & index.mask;
+      while (index.crc_slots[slot] >= 0 && index.keys[index.crc_slots[slot]].crc != key.crc)
+         slot = (slot + 1) & index.mask;
+      if (index.crc_slots[slot] < 0)
+         index.crc_slots[slot] = i;
+
+      if (key.name == NULL)
+         continue;
+
+      slot = rom_index_hash_name(key.name) & index.mask;
+      while (index.name_slots[slot] >= 0 && strcmp(index.keys[index.name_slots[slot]].name, key.name) != 0)
+         slot = (slot + 1) & index.mask;
+      if (index.name_slots[slot] < 0)
+         index.name_slots[slot] = i;
    }
+}
 
-#if 0
-   log_cb(RETRO_LOG_ERROR, "Not found: %s (name = %s)\n", list[i].szName, name);
-#endif
+static void rom_index_build(rom_index &index, const ZipEntry *list, unsigned elems)
+{
+   index.keys.resize(elems);
+   for (unsigned i = 0; i < elems; i++)
+   {
+      index.keys[i].name = list[i].szName;
+      index.keys[i].crc = list[i].nCrc;
+   }
+   rom_index_build(index);
+}
 
+static int rom_index_find_crc(const rom_index &index, uint32_t crc)
+{
+   unsigned slot = rom_index_hash_crc(crc) & index.mask;
+   while (index.crc_slots[slot] >= 0)
+   {
+      if (index.keys[index.crc_slots[slot]].crc == crc)
+         return index.crc_slots[slot];
+      slot = (slot + 1) & index.mask;
+   }
    return -1;
 }
 
-static int find_rom_by_crc(uint32_t crc, const ZipEntry *list, unsigned elems)
+static int rom_index_find_name(const rom_index &index, const char *name)
 {
-   unsigned i = 0;
-   for (i = 0; i < elems; i++)
+   unsigned slot = rom_index_hash_name(name) & index.mask;
+   while (index.name_slots[slot] >= 0)
    {
-      if (list[i].nCrc == crc)
-     {
-         return i;
-     }
+      if (strcmp(index.keys[index.name_slots[slot]].name, name) == 0)
+         return index.name_slots[slot];
+      slot = (slot + 1) & index.mask;
    }
+   return -1;
+}
+
+// addition to support loading of roms without crc check
+static int find_rom_by_name(char *name, const rom_index &index)
+{
+   int i = rom_index_find_name(index, name);
 
 #if 0
-   log_cb(RETRO_LOG_ERROR, "Not found: 0x%X (crc: 0x%X)\n", list[i].nCrc, crc);
+   if (i < 0)
+      log_cb(RETRO_LOG_ERROR, "Not found: %s\n", name);
 #endif
 
-   return -1;
+   return i;
+}
+
+static int find_rom_by_crc(uint32_t crc, const rom_index &index)
+{
+   int i = rom_index_find_crc(index, crc);
+
+#if 0
+   if (i < 0)
+      log_cb(RETRO_LOG_ERROR, "Not found: 0x%X\n", crc);
+#endif
+
+   return i;
 }
 
-static RomBiosInfo* find_bios_info(char *szName, uint32_t crc, struct RomBiosInfo* bioses)
+static rom_index mvs_bios_lookup;
+static rom_index aes_bios_lookup;
+static rom_index uni_bios_lookup;
+
+static RomBiosInfo* find_bios_info(char *szName, uint32_t crc, struct RomBiosInfo* bioses, rom_index &index)
 {
-   for (int i = 0; bioses[i].filename != NULL; i++)
+   // The bios tables never change, index them the first time they are needed
+   if (index.keys.empty())
    {
-      if (strcmp(bioses[i].filename, szName) == 0 || bioses[i].crc == crc)
+      for (int i = 0; bioses[i].filename != NULL; i++)
       {
-         return &bioses[i];
+         rom_index_key key = { bioses[i].filename, bioses[i].crc };
+         index.keys.push_back(key);
       }
+      rom_index_build(index);
    }
 
+   int by_name = rom_index_find_name(index, szName);
+   int by_crc = rom_index_find_crc(index, crc);
+   int i = (by_name >= 0 && (by_crc < 0 || by_name < by_crc)) ? by_name : by_crc;
+
+   if (i >= 0)
+      return &bioses[i];
+
 #if 0
    log_cb(RETRO_LOG_ERROR, "Bios not found: %s (crc: 0x%08x)\n", szName, crc);
 #endif
@@ -534,6 +652,51 @@ static void free_archive_list(ZipEntry *list, unsigned count)
    }
 }
 
+// Make archive the current zipfn archive, reusing the parked handle if there is one
+static int archive_select(int archive)
+{
+   if (archive == g_archive_current)
+      return 0;
+
+   if (g_archive_current >= 0)
+   {
+      if (ZipPark(g_archive_current) != 0)
+         ZipClose();
+      g_archive_current = -1;
+   }
+
+   if (ZipUnpark(archive) != 0)
+   {
+      if (ZipOpen((char*)g_find_list_path[archive].c_str()) != 0)
+         return 1;
+
+      // Parse the directory once, so later entries can be reached without walking the archive
+      ZipEntry *list = NULL;
+      int count = 0;
+      if (ZipGetList(&list, &count) == 0)
+         free_archive_list(list, count);
+   }
+
+   g_archive_current = archive;
+   return 0;
+}
+
+static void archive_close_all()
+{
+   if (g_archive_current >= 0)
+      ZipClose();
+   g_archive_current = -1;
+
+   ZipCloseParked();
+
+   if (g_archive_streaming && g_rom_load_count)
+      log_cb(RETRO_LOG_INFO, "[FBA] Loaded %u ROMs in %lld us\n", g_rom_load_count, (long long)g_rom_load_time);
+
+   g_archive_streaming = false;
+   g_rom_load_count = 0;
+   g_rom_load_time = 0;
+}
+
 static int archive_load_rom(uint8_t *dest, int *wrote, int i)
 {
    if (i < 0 || i >= g_rom_count)
@@ -541,19 +704,44 @@ static int archive_load_rom(uint8_t *dest, int *wrote, int i)
 
    int archive = g_find_list[i].nArchive;
 
-   if (ZipOpen((char*)g_find_list_path[archive].c_str()) != 0)
-      return 1;
+   retro_time_t start = cpu_features_get_time_usec();
 
    BurnRomInfo ri = {0};
    BurnDrvGetRomInfo(&ri, i);
 
-   if (ZipLoadFile(dest, ri.nLen, wrote, g_find_list[i].nPos) != 0)
+   bool cached = RomCacheLoad(dest, wrote, ri.nCrc, ri.nLen);
+
+   if (!cached)
    {
-      ZipClose();
-      return 1;
+      if (archive_select(archive) != 0)
+         return 1;
+
+      int written = 0;
+      int ret = ZipLoadFile(dest, ri.nLen, &written, g_find_list[i].nPos);
+
+      if (!g_archive_streaming)
+      {
+         ZipClose();
+         g_archive_current = -1;
+      }
+
+      if (ret != 0)
+         return 1;
+
+      if (wrote)
+         *wrote = written;
+
+      // Only keep roms that match the crc the driver expects
+      if (g_find_list[i].nState == STAT_OK && !g_find_list[i].bBadCrc && ri.nCrc != 0 && written == (int)ri.nLen)
+         RomCacheStore(dest, ri.nCrc, ri.nLen);
    }
 
-   ZipClose();
+   retro_time_t elapsed = cpu_features_get_time_usec() - start;
+   g_rom_load_count++;
+   g_rom_load_time += elapsed;
+
+   log_cb(RETRO_LOG_DEBUG, "[FBA] ROM %d (0x%08x, %u bytes) loaded from %s in %lld us\n", i, ri.nCrc, ri.nLen, cached ? "rom cache" : g_find_list_path[archive].c_str(), (long long)elapsed);
+
    return 0;
 }
 
@@ -566,6 +754,8 @@ static void locate_archive(std::vector<std::string>& pathList, const char* const
 	if (ZipOpen(path) == 0)
 	{
 		g_find_list_path.push_back(path);
+		if (ZipPark(g_find_list_path.size() - 1) != 0)
+			ZipClose();
 		return;
 	}
 	// Search system fba subdirectory (where samples/hiscore are stored)
@@ -573,6 +763,8 @@ static void locate_archive(std::vector<std::string>& pathList, const char* const
 	if (ZipOpen(path) == 0)
 	{
 		g_find_list_path.push_back(path);
+		if (ZipPark(g_find_list_path.size() - 1) != 0)
+			ZipClose();
 		return;
 	}
 	// Search system directory
@@ -580,6 +772,8 @@ static void locate_archive(std::vector<std::string>& pathList, const char* const
 	if (ZipOpen(path) == 0)
 	{
 		g_find_list_path.push_back(path);
+		if (ZipPark(g_find_list_path.size() - 1) != 0)
+			ZipClose();
 		return;
 	}
 
@@ -591,6 +785,8 @@ static bool open_archive()
 {
    memset(g_find_list, 0, sizeof(g_find_list));
 
+   archive_close_all();
+
    // FBA wants some roms ... Figure out how many.
    g_rom_count = 0;
    while (!BurnDrvGetRomInfo(&g_find_list[g_rom_count].ri, g_rom_count))
@@ -615,22 +811,24 @@ static bool open_archive()
       {
          locate_archive(g_find_list_path, "pgm");
       }
-
-      ZipClose();
    }
 
    for (unsigned z = 0; z < g_find_list_path.size(); z++)
    {
-      if (ZipOpen((char*)g_find_list_path[z].c_str()) != 0)
+      if (archive_select(z) != 0)
       {
          log_cb(RETRO_LOG_ERROR, "[FBA] Failed to open archive %s\n", g_find_list_path[z].c_str());
+         archive_close_all();
          return false;
       }
 
       ZipEntry *list = NULL;
-      int count;
+      int count = 0;
       ZipGetList(&list, &count);
 
+      rom_index lookup;
+      rom_index_build(lookup, list, count);
+
       // Try to map the ROMs FBA wants to ROMs we find inside our pretty archives ...
       for (unsigned i = 0; i < g_rom_count; i++)
       {
@@ -643,7 +841,7 @@ static bool open_archive()
             continue;
          }
 
-         int index = find_rom_by_crc(g_find_list[i].ri.nCrc, list, count);
+         int index = find_rom_by_crc(g_find_list[i].ri.nCrc, lookup);
 
          BurnDrvGetRomName(&rom_name, i, 0);
 
@@ -651,7 +849,7 @@ static bool open_archive()
 
          if (index < 0)
          {
-            index = find_rom_by_name(rom_name, list, count);
+            index = find_rom_by_name(rom_name, lookup);
             if (index >= 0)
                bad_crc = true;
          }
@@ -674,7 +872,7 @@ static bool open_archive()
             RomBiosInfo *bios;
 
             // MVS BIOS
-            bios = find_bios_info(list[index].szName, list[index].nCrc, mvs_bioses);
+            bios = find_bios_info(list[index].szName, list[index].nCrc, mvs_bioses, mvs_bios_lookup);
             if (bios)
             {
                if (!available_mvs_bios || (available_mvs_bios && bios->priority < available_mvs_bios->priority))
@@ -682,7 +880,7 @@ static bool open_archive()
             }
 
             // AES BIOS
-            bios = find_bios_info(list[index].szName, list[index].nCrc, aes_bioses);
+            bios = find_bios_info(list[index].szName, list[index].nCrc, aes_bioses, aes_bios_lookup);
             if (bios)
             {
                if (!available_aes_bios || (available_aes_bios && bios->priority < available_aes_bios->priority))
@@ -690,7 +888,7 @@ static bool open_archive()
             }
 
             // Universe BIOS
-            bios = find_bios_info(list[index].szName, list[index].nCrc, uni_bioses);
+            bios = find_bios_info(list[index].szName, list[index].nCrc, uni_bioses, uni_bios_lookup);
             if (bios)
             {
                if (!available_uni_bios || (available_uni_bios && bios->priority < available_uni_bios->priority))
@@ -701,6 +899,7 @@ static bool open_archive()
          // Yay, we found it!
          g_find_list[i].nArchive = z;
          g_find_list[i].nPos = index;
+         g_find_list[i].bBadCrc = bad_crc;
          g_find_list[i].nState = STAT_OK;
 
          if (list[index].nLen < g_find_list[i].ri.nLen)
@@ -710,7 +909,6 @@ static bool open_archive()
       }
 
       free_archive_list(list, count);
-      ZipClose();
    }
 
    bool is_neogeo_bios_available = false;
@@ -742,11 +940,13 @@ static bool open_archive()
                continue;
 
             log_cb(RETRO_LOG_ERROR, "[FBA] ROM at index %d with CRC 0x%08x is required ...\n", i, g_find_list[i].ri.nCrc);
+            archive_close_all();
             return false;
          }
       }
    }
 
+   g_archive_streaming = true;
    BurnExtLoadRom = archive_load_rom;
    return true;
 }
@@ -836,6 +1036,7 @@ void retro_init()
 
 void retro_deinit()
 {
+	ThreadsExit();
 	BurnLibExit();
 }
 
@@ -851,6 +1052,9 @@ void retro_reset()
       *(pgi_reset->Input.pVal) = pgi_reset->Input.nVal;
    }
 
+   // a reset may reallocate some areas
+   StateLayoutReset();
+
    check_variables();
 
    apply_dipswitch_from_variables();
@@ -858,17 +1062,62 @@ void retro_reset()
    ForceFrameStep(1);
 }
 
+// Emulate the frame without drawing it, then the hidden frames with the same inputs and show the last one.
+// The state after the first frame is kept in memory and restored at the end, so only the first frame counts.
+static void RunAheadFrameStep()
+{
+	pBurnDraw = NULL;
+	ForceFrameStep(0);
+
+	if (!StateSnapshotSave(&g_runahead_state))
+	{
+		log_cb(RETRO_LOG_WARN, "[FBA] Run-ahead disabled, the state of this game can't be saved\n");
+		nRunAhead = 0;
+		return;
+	}
+
+	retro_time_t start = cpu_features_get_time_usec();
+	UINT32 frame = nCurrentFrame;
+	bool draw = (frame % nFrameskip == 0);
+
+	// audio of the hidden frames is thrown away
+	pBurnSoundOut = g_runahead_audio_buf;
+	for (UINT32 i = 0; i < nRunAhead; i++)
+	{
+		pBurnDraw = (i == nRunAhead - 1) ? pVidImage : NULL;
+		ForceFrameStep(draw && i == nRunAhead - 1);
+	}
+	pBurnSoundOut = g_audio_buf;
+
+	if (!StateSnapshotLoad(&g_runahead_state))
+	{
+		log_cb(RETRO_LOG_WARN, "[FBA] Run-ahead disabled, the state of this game can't be restored\n");
+		nRunAhead = 0;
+	}
+	nCurrentFrame = frame;
+
+	g_runahead_count++;
+	g_runahead_time += cpu_features_get_time_usec() - start;
+}
+
 void retro_run()
 {
 	pBurnDraw = pVidImage;
 
 	InputMake();
 
-	ForceFrameStep(nCurrentFrame % nFrameskip == 0);
+	if (nRunAhead && g_runahead_audio_buf)
+		RunAheadFrameStep();
+	else
+		ForceFrameStep(nCurrentFrame % nFrameskip == 0);
 
-	video_cb(pVidImage, nGameWidth, nGameHeight, nBurnPitch);
+	// let the frontend reuse the last frame when BurnTransferCopy() didn't change a line
+	if (g_can_dupe && BurnTransferFrameUnchanged())
+		video_cb(NULL, nGameWidth, nGameHeight, nBurnPitch);
+	else
+		video_cb(pVidImage, nGameWidth, nGameHeight, nBurnPitch);
 
-	audio_batch_cb(g_audio_buf, nBurnSoundLen);
+	AudioRateOutput(audio_batch_cb, g_audio_buf, nBurnSoundLen);
 	bool updated = false;
 
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
@@ -897,17 +1146,9 @@ void retro_run()
 	}
 }
 
-static uint8_t *write_state_ptr;
 static const uint8_t *read_state_ptr;
 static unsigned state_sizes[2];
 
-static int burn_write_state_cb(BurnArea *pba)
-{
-	memcpy(write_state_ptr, pba->Data, pba->nLen);
-	write_state_ptr += pba->nLen;
-	return 0;
-}
-
 static int burn_read_state_cb(BurnArea *pba)
 {
 	memcpy(pba->Data, read_state_ptr, pba->nLen);
@@ -956,9 +1197,11 @@ bool retro_serialize(void *data, size_t size)
 	if (size != state_sizes[kNetGame])
 		return false;
 
-	BurnAcb = burn_write_state_cb;
-	write_state_ptr = (uint8_t*)data;
-	BurnAreaScan(ACB_FULLSCAN | ACB_READ, 0);   
+	retro_time_t start = cpu_features_get_time_usec();
+
+	StateWrite((uint8_t*)data, size);
+
+	StateStatsSerialize(size, cpu_features_get_time_usec() - start);
 	return true;
 }
 
@@ -978,10 +1221,14 @@ bool retro_unserialize(const void *data, size_t size)
 	if (size != state_sizes[kNetGame])
 		return false;
 
+	retro_time_t start = cpu_features_get_time_usec();
+
 	BurnAcb = burn_read_state_cb;
 	read_state_ptr = (const uint8_t*)data;
 	BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, 0);
 	BurnRecalcPal();
+
+	StateStatsUnserialize(size, cpu_features_get_time_usec() - start);
 	return true;
 }
 
@@ -1094,6 +1341,9 @@ static void init_audio_buffer(INT32 sample_rate, INT32 fps)
 		free(g_audio_buf);
 	g_audio_buf = (int16_t*)malloc(nAudSegLen<<2 * sizeof(int16_t));
 	memset(g_audio_buf, 0, nAudSegLen<<2 * sizeof(int16_t));
+	if (g_runahead_audio_buf)
+		free(g_runahead_audio_buf);
+	g_runahead_audio_buf = (int16_t*)malloc(nAudSegLen<<2 * sizeof(int16_t));
 	nBurnSoundLen = nAudSegLen;
 	pBurnSoundOut = g_audio_buf;
 }
@@ -1166,6 +1416,14 @@ static bool retro_load_game_common()
 	// Intialize state_sizes (for serialization)
 	state_sizes[0] = 0;
 	state_sizes[1] = 0;
+	StateStatsReset();
+	AudioStatsReset();
+	StateLayoutReset();
+	g_runahead_count = 0;
+	g_runahead_time = 0;
+
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &g_can_dupe))
+		g_can_dupe = false;
 
 	nBurnDrvActive = BurnDrvGetIndexByName(g_driver_name);
 	if (nBurnDrvActive < nBurnDrvCount) {
@@ -1206,8 +1464,19 @@ static bool retro_load_game_common()
 		// Initialize dipswitches
 		InpDIPSWInit();
 
+		// Inflated roms are kept in the system dir if the archive cache is enabled
+		char cache_dir[MAX_PATH];
+		snprintf(cache_dir, sizeof(cache_dir), "%s%cfba%ccache%c", g_system_dir, path_default_slash_c(), path_default_slash_c(), path_default_slash_c());
+		if (nRomCacheLimit)
+			path_mkdir(cache_dir);
+		RomCacheOpen(cache_dir, g_driver_name);
+
 		// Initialize game driver
-		BurnDrvInit();
+		INT32 nInitRet = BurnDrvInit();
+
+		// All roms are loaded now, release the archives kept open for it
+		archive_close_all();
+		RomCacheClose(nInitRet == 0);
 
 		// If the game is marked as not working, let's stop here
 		if (!(BurnDrvIsWorking())) {
@@ -1217,6 +1486,7 @@ static bool retro_load_game_common()
 
 		// Now we know real game fps, let's initialize sound buffer again
 		init_audio_buffer(nBurnSoundRate, nBurnFPS);
+		AudioRateInit(nBurnSoundRate, nBurnSoundLen);
 
 		// Get MainRam for RetroAchievements support
 		INT32 nMin = 0;
@@ -1323,11 +1593,29 @@ void retro_unload_game(void)
 {
 	if (driver_inited)
 	{
+		StateStatsLog();
+		AudioStatsLog();
+		AudioRateExit();
+		if (g_runahead_count)
+			log_cb(RETRO_LOG_INFO, "[FBA] Run-ahead: %u frames, %lld us of hidden frames and rollback per frame\n", g_runahead_count, (long long)(g_runahead_time / g_runahead_count));
+		StateLayoutReset();
+		StateSnapshotFree(&g_runahead_state);
+		if (bBurnTransferSkipRows)
+		{
+			UINT64 rows, skipped;
+			UINT32 frames, unchanged;
+			BurnTransferGetStats(&rows, &skipped, &frames, &unchanged);
+			if (rows)
+				log_cb(RETRO_LOG_INFO, "[FBA] Transfer: %u frames, %.1f%% of lines skipped, %u frames unchanged\n", frames, skipped * 100.0 / rows, unchanged);
+		}
 		BurnStateSave(g_autofs_path, 0);
 		if (pVidImage)
 			free(pVidImage);
 		if (g_audio_buf)
 			free(g_audio_buf);
+		if (g_runahead_audio_buf)
+			free(g_runahead_audio_buf);
+		g_runahead_audio_buf = NULL;
 		BurnDrvExit();
 		if (nGameType == RETRO_GAME_TYPE_NEOCD)
 			CDEmuExit();
@@ -0,0 +1,207 @@
+#include "retro_common.h"
+#include "retro_audio.h"
+
+// The audio buffer status callback is newer than our libretro.h
+#ifndef RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK
+#define RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK 62
+typedef void (RETRO_CALLCONV *retro_audio_buffer_status_callback_t)(bool active, unsigned occupancy, bool underrun_likely);
+struct retro_audio_buffer_status_callback
+{
+	retro_audio_buffer_status_callback_t callback;
+};
+#endif
+#ifndef RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY
+#define RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY 63
+#endif
+
+#define AUDIO_RATE_SMOOTHING	16		// frames to follow the buffer status halfway, roughly
+
+UINT32 nAudioRatePpm = 0;
+UINT32 nAudioLatency = 0;
+
+static INT32 nRateSampleRate = 0;
+static UINT32 nRateLatency = 0;			// the latency the frontend took, 0 if unknown
+static INT16* pRateBuf = NULL;
+static INT32 nRateBufLen = 0;			// in stereo samples
+static INT16 nRateLast[2];				// last sample of the previous frame, to interpolate from
+static double dRate = 1.0;
+static double dRateFraction = 0.0;		// samples carried over to the next frame
+
+static bool bStatus = false;			// the frontend calls AudioBufferStatus()
+static bool bStatusActive = false;
+static UINT32 nStatusOccupancy = 0;
+static bool bStatusUnderrun = false;
+
+static struct {
+	UINT32 nFrames;
+	UINT32 nStatusFrames;
+	UINT32 nUnderruns;
+	UINT64 nSamplesIn;
+	UINT64 nSamplesOut;
+	double dPpmMin;
+	double dPpmMax;
+	double dOccupancy;
+	double dLatency;					// in ms
+} AudioStats;
+
+static void RETRO_CALLCONV AudioBufferStatus(bool active, unsigned occupancy, bool underrun_likely)
+{
+	bool bUnderrun = active && (underrun_likely || occupancy == 0);
+
+	// count an underrun when it starts, not on every frame the buffer stays low
+	if (bUnderrun && !bStatusUnderrun)
+		AudioStats.nUnderruns++;
+
+	bStatusActive = active;
+	nStatusOccupancy = occupancy > 100 ? 100 : occupancy;
+	bStatusUnderrun = bUnderrun;
+}
+
+void AudioRateInit(INT32 nSampleRate, INT32 nFrameLen)
+{
+	AudioRateExit();
+
+	nRateSampleRate = nSampleRate;
+
+	// room for the longest frame of the widest window, 1%
+	nRateBufLen = nFrameLen + nFrameLen / 64 + 2;
+	pRateBuf = (INT16*)malloc(nRateBufLen * 2 * sizeof(INT16));
+
+	nRateLast[0] = nRateLast[1] = 0;
+	dRate = 1.0;
+	dRateFraction = 0.0;
+
+	bStatusActive = false;
+	nStatusOccupancy = 0;
+	bStatusUnderrun = false;
+
+	struct retro_audio_buffer_status_callback status = { AudioBufferStatus };
+	bStatus = environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, &status);
+	if (!bStatus && nAudioRatePpm)
+		log_cb(RETRO_LOG_WARN, "[FBA] The frontend doesn't report its audio buffer, audio rate control disabled\n");
+
+	nRateLatency = 0;
+	if (nAudioLatency)
+	{
+		unsigned latency = nAudioLatency;
+		if (environ_cb(RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY, &latency))
+			nRateLatency = nAudioLatency;
+		else
+			log_cb(RETRO_LOG_WARN, "[FBA] The frontend can't set the audio latency to %u ms\n", nAudioLatency);
+	}
+}
+
+void AudioRateExit()
+{
+	if (bStatus)
+		environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, NULL);
+	bStatus = false;
+
+	if (pRateBuf)
+		free(pRateBuf);
+	pRateBuf = NULL;
+	nRateBufLen = 0;
+}
+
+// Resamples nLen samples to nOut with linear interpolation. Output sample i is taken at
+// (i + 1) * nLen / nOut - 1 in the input, so the last one is the last input sample and a frame
+// starts where the previous one ended; with nOut == nLen the samples are copied as they are.
+static void AudioRateResample(const INT16* pSrc, INT32 nLen, INT16* pDst, INT32 nOut)
+{
+	for (INT32 i = 0; i < nOut; i++)
+	{
+		INT64 nPos = ((INT64)(i + 1) * nLen << 16) / nOut - 0x10000;
+		INT32 nIndex = (INT32)(nPos >> 16);
+		INT32 nFrac = (INT32)(nPos & 0xffff);
+
+		const INT16* pA = nIndex < 0 ? nRateLast : pSrc + nIndex * 2;
+		const INT16* pB = pSrc + (nIndex + 1) * 2;
+
+		if (nFrac == 0) {
+			pB = pA;
+		}
+
+		// a full 16 bit step times a 16 bit fraction doesn't fit an INT32
+
+		pDst[i * 2 + 0] = pA[0] + (INT32)(((INT64)(pB[0] - pA[0]) * nFrac) >> 16);
+		pDst[i * 2 + 1] = pA[1] + (INT32)(((INT64)(pB[1] - pA[1]) * nFrac) >> 16);
+	}
+}
+
+void AudioRateOutput(retro_audio_sample_batch_t pBatch, INT16* pSamples, INT32 nLen)
+{
+	INT32 nOut = nLen;
+
+	if (nAudioRatePpm && bStatus && pRateBuf)
+	{
+		double dTarget = 1.0;
+
+		// a buffer under half full wants more samples, over half full fewer
+		if (bStatusActive)
+			dTarget = 1.0 + (50.0 - nStatusOccupancy) / 50.0 * nAudioRatePpm / 1000000.0;
+
+		dRate += (dTarget - dRate) / AUDIO_RATE_SMOOTHING;
+
+		double dOut = nLen * dRate + dRateFraction;
+		nOut = (INT32)dOut;
+		if (nOut > nRateBufLen)
+			nOut = nRateBufLen;
+		dRateFraction = dOut - nOut;
+	}
+
+	if (nOut == nLen)
+		pBatch(pSamples, nLen);
+	else
+	{
+		AudioRateResample(pSamples, nLen, pRateBuf, nOut);
+		pBatch(pRateBuf, nOut);
+	}
+
+	if (nLen)
+	{
+		nRateLast[0] = pSamples[nLen * 2 - 2];
+		nRateLast[1] = pSamples[nLen * 2 - 1];
+	}
+
+	double dPpm = (dRate - 1.0) * 1000000.0;
+	if (AudioStats.nFrames == 0 || dPpm < AudioStats.dPpmMin)
+		AudioStats.dPpmMin = dPpm;
+	if (AudioStats.nFrames == 0 || dPpm > AudioStats.dPpmMax)
+		AudioStats.dPpmMax = dPpm;
+
+	AudioStats.nFrames++;
+	AudioStats.nSamplesIn += nLen;
+	AudioStats.nSamplesOut += nOut;
+
+	if (bStatus && bStatusActive)
+	{
+		AudioStats.nStatusFrames++;
+		AudioStats.dOccupancy += nStatusOccupancy;
+		// the frame just made, then what is queued in the frontend
+		AudioStats.dLatency += nOut * 1000.0 / nRateSampleRate + nStatusOccupancy * nRateLatency / 100.0;
+	}
+}
+
+void AudioStatsLog()
+{
+	if (AudioStats.nFrames == 0)
+		return;
+
+	double dPpm = ((double)AudioStats.nSamplesOut / AudioStats.nSamplesIn - 1.0) * 1000000.0;
+
+	log_cb(RETRO_LOG_INFO, "[FBA] Audio: %u frames, %u underruns, rate %+.0f ppm (%+.0f to %+.0f)\n", AudioStats.nFrames, AudioStats.nUnderruns, dPpm, AudioStats.dPpmMin, AudioStats.dPpmMax);
+
+	if (AudioStats.nStatusFrames)
+	{
+		// the frontend buffer is only known to be at least the latency we asked for
+		if (nRateLatency)
+			log_cb(RETRO_LOG_INFO, "[FBA] Audio: buffer %.0f%% full, at least %.1f ms of latency on average\n", AudioStats.dOccupancy / AudioStats.nStatusFrames, AudioStats.dLatency / AudioStats.nStatusFrames);
+		else
+			log_cb(RETRO_LOG_INFO, "[FBA] Audio: buffer %.0f%% full on average\n", AudioStats.dOccupancy / AudioStats.nStatusFrames);
+	}
+}
+
+void AudioStatsReset()
+{
+	memset(&AudioStats, 0, sizeof(AudioStats));
+}
@@ -0,0 +1,19 @@
+#ifndef __RETRO_AUDIO__
+#define __RETRO_AUDIO__
+
+#include "burner.h"
+
+// Dynamic rate control: each frame of nBurnSoundLen samples is stretched by up to nAudioRatePpm
+// (0 disables it), to keep the audio buffer of the frontend half full
+extern UINT32 nAudioRatePpm;
+// Minimum audio latency asked of the frontend in ms (0 = the frontend's own), at game load
+extern UINT32 nAudioLatency;
+
+void AudioRateInit(INT32 nSampleRate, INT32 nFrameLen);
+void AudioRateExit();
+void AudioRateOutput(retro_audio_sample_batch_t pBatch, INT16* pSamples, INT32 nLen);
+
+void AudioStatsLog();
+void AudioStatsReset();
+
+#endif
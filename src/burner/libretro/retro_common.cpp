@@ -1,5 +1,12 @@
 #include "retro_common.h"
+#include "retro_audio.h"
 #include "retro_input.h"
+#include "retro_romcache.h"
+#include "retro_state.h"
+#include "retro_threads.h"
+#ifdef SH2_X64_DRC
+#include "sh2_intf.h"
+#endif
 
 struct RomBiosInfo mvs_bioses[] = {
 	{"sp-s3.sp1",         0x91b64be3, 0x00, "MVS Asia/Europe ver. 6 (1 slot)",  1 },
@@ -87,6 +94,20 @@ static const struct retro_variable var_fba_samplerate = { "fba-samplerate", "Sam
 static const struct retro_variable var_fba_sample_interpolation = { "fba-sample-interpolation", "Sample Interpolation; 4-point 3rd order|2-point 1st order|disabled" };
 static const struct retro_variable var_fba_fm_interpolation = { "fba-fm-interpolation", "FM Interpolation; 4-point 3rd order|disabled" };
 static const struct retro_variable var_fba_analog_speed = { "fba-analog-speed", "Analog Speed; 10|9|8|7|6|5|4|3|2|1" };
+static const struct retro_variable var_fba_archive_cache = { "fba-archive-cache", "Keep the unzipped roms in system dir, saves the unzipping only (cache size); disabled|256 MB|512 MB|1024 MB|2048 MB|4096 MB" };
+static const struct retro_variable var_fba_sample_cache = { "fba-sample-cache", "Cache converted samples next to the sample zip; disabled|enabled" };
+static const struct retro_variable var_fba_skip_unchanged_lines = { "fba-skip-unchanged-lines", "Skip unchanged lines when converting the screen; disabled|enabled" };
+static const struct retro_variable var_fba_tilemap_threads = { "fba-tilemap-threads", "Threads for line scrolled tilemaps (drivers using the generic tilemaps); 1|2|3|4" };
+static const struct retro_variable var_fba_sound_profile = { "fba-sound-profile", "Time the sound chips and log a report at exit (applied at game load); disabled|enabled" };
+static const struct retro_variable var_fba_audio_rate_control = { "fba-audio-rate-control", "Adjust the audio rate to the buffer of the frontend; disabled|0.1%|0.25%|0.5%|1%" };
+static const struct retro_variable var_fba_audio_latency = { "fba-audio-latency", "Minimum audio latency in ms (applied at game load); default|32|48|64|96|128" };
+static const struct retro_variable var_fba_sound_thread = { "fba-sound-thread", "Render the YM2610 on a thread of its own (applied at game load); disabled|enabled" };
+static const struct retro_variable var_fba_handler_profile = { "fba-handler-profile", "Count the 68000 accesses that go through handlers and log a report at exit (applied at game load); disabled|enabled" };
+static const struct retro_variable var_fba_idle_skip = { "fba-idle-skip", "Skip idle loops of the 68000, Z80 and ARM7 (applied at game load); disabled|enabled|all games" };
+static const struct retro_variable var_fba_runahead = { "fba-runahead", "Run-ahead frames (hides game lag, needs working save states); 0|1|2|3|4" };
+#ifdef SH2_X64_DRC
+static const struct retro_variable var_fba_sh2_drc = { "fba-sh2-drc", "SH-2 recompiler (lockstep test checks it against the interpreter, slow); enabled|disabled|lockstep test" };
+#endif
 #ifdef USE_CYCLONE
 static const struct retro_variable var_fba_cyclone = { "fba-cyclone", "Cyclone (need to quit retroarch, change savestate format, use at your own risk); disabled|enabled" };
 #endif
@@ -236,6 +257,20 @@ void set_environment()
 	vars_systems.push_back(&var_fba_sample_interpolation);
 	vars_systems.push_back(&var_fba_fm_interpolation);
 	vars_systems.push_back(&var_fba_analog_speed);
+	vars_systems.push_back(&var_fba_archive_cache);
+	vars_systems.push_back(&var_fba_sample_cache);
+	vars_systems.push_back(&var_fba_skip_unchanged_lines);
+	vars_systems.push_back(&var_fba_tilemap_threads);
+	vars_systems.push_back(&var_fba_sound_thread);
+	vars_systems.push_back(&var_fba_sound_profile);
+	vars_systems.push_back(&var_fba_audio_rate_control);
+	vars_systems.push_back(&var_fba_audio_latency);
+	vars_systems.push_back(&var_fba_handler_profile);
+	vars_systems.push_back(&var_fba_idle_skip);
+	vars_systems.push_back(&var_fba_runahead);
+#ifdef SH2_X64_DRC
+	vars_systems.push_back(&var_fba_sh2_drc);
+#endif
 #ifdef USE_CYCLONE
 	vars_systems.push_back(&var_fba_cyclone);
 #endif
@@ -531,6 +566,132 @@ void check_variables(void)
 			nAnalogSpeed = 0x0100;
 	}
 
+	var.key = var_fba_archive_cache.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "disabled") == 0)
+			nRomCacheLimit = 0;
+		else
+			nRomCacheLimit = atoi(var.value);
+	}
+
+	var.key = var_fba_sample_cache.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnSampleCacheFile = 1;
+		else
+			bBurnSampleCacheFile = 0;
+	}
+
+	var.key = var_fba_skip_unchanged_lines.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnTransferSkipRows = true;
+		else
+			bBurnTransferSkipRows = false;
+	}
+
+	var.key = var_fba_tilemap_threads.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "2") == 0)
+			nRenderThreads = 2;
+		else if (strcmp(var.value, "3") == 0)
+			nRenderThreads = 3;
+		else if (strcmp(var.value, "4") == 0)
+			nRenderThreads = 4;
+		else
+			nRenderThreads = 1;
+		bGenericTilemapThreads = (nRenderThreads > 1);
+		ThreadsInit(nRenderThreads);
+	}
+
+	var.key = var_fba_sound_thread.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		ThreadsSetSound(strcmp(var.value, "enabled") == 0);
+	}
+
+	// FBA_SOUND_PROFILE in the environment turns the profiler on without the option
+	var.key = var_fba_sound_profile.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+		bBurnSoundProfile = strcmp(var.value, "enabled") == 0 || getenv("FBA_SOUND_PROFILE");
+	else
+		bBurnSoundProfile = getenv("FBA_SOUND_PROFILE") != NULL;
+
+	// FBA_HANDLER_PROFILE in the environment turns the counters on without the option
+	var.key = var_fba_handler_profile.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+		bBurnHandlerProfile = strcmp(var.value, "enabled") == 0 || getenv("FBA_HANDLER_PROFILE");
+	else
+		bBurnHandlerProfile = getenv("FBA_HANDLER_PROFILE") != NULL;
+
+	// "all games" ignores the deny list of burn_idle.cpp
+	var.key = var_fba_idle_skip.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			nBurnIdleMode = 1;
+		else if (strcmp(var.value, "all games") == 0)
+			nBurnIdleMode = 2;
+		else
+			nBurnIdleMode = 0;
+	}
+
+	var.key = var_fba_audio_rate_control.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "0.1%") == 0)
+			nAudioRatePpm = 1000;
+		else if (strcmp(var.value, "0.25%") == 0)
+			nAudioRatePpm = 2500;
+		else if (strcmp(var.value, "0.5%") == 0)
+			nAudioRatePpm = 5000;
+		else if (strcmp(var.value, "1%") == 0)
+			nAudioRatePpm = 10000;
+		else
+			nAudioRatePpm = 0;
+	}
+
+	var.key = var_fba_audio_latency.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "default") == 0)
+			nAudioLatency = 0;
+		else
+			nAudioLatency = atoi(var.value);
+	}
+
+	var.key = var_fba_runahead.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "1") == 0)
+			nRunAhead = 1;
+		else if (strcmp(var.value, "2") == 0)
+			nRunAhead = 2;
+		else if (strcmp(var.value, "3") == 0)
+			nRunAhead = 3;
+		else if (strcmp(var.value, "4") == 0)
+			nRunAhead = 4;
+		else
+			nRunAhead = 0;
+	}
+
+#ifdef SH2_X64_DRC
+	var.key = var_fba_sh2_drc.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+	{
+		if (strcmp(var.value, "disabled") == 0)
+			sh2_drc_mode = SH2_DRC_OFF;
+		else if (strcmp(var.value, "lockstep test") == 0)
+			sh2_drc_mode = SH2_DRC_LOCKSTEP;
+		else
+			sh2_drc_mode = SH2_DRC_ON;
+	}
+#endif
+
 #ifdef USE_CYCLONE
 	var.key = var_fba_cyclone.key;
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
@@ -0,0 +1,425 @@
+// Rom cache, keeps the inflated roms of a driver in a single file keyed by crc,
+// so warm boots don't have to inflate the zip/7z archives again. The roms are copied
+// into the driver's buffers as the archive would, the driver still decodes them.
+// The caches of all drivers are kept under nRomCacheLimit, least recently used first out
+#include "retro_common.h"
+#include "retro_romcache.h"
+#include "memmap.h"
+
+#ifdef HAVE_MMAN
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#define ROMCACHE_VERSION	1
+#define ROMCACHE_ALIGN		16
+
+struct RomCacheHeader
+{
+	char szMagic[4];
+	UINT32 nVersion;
+	UINT32 nEntries;
+	UINT32 nTableOffset;
+};
+
+struct RomCacheEntry
+{
+	UINT32 nCrc;
+	UINT32 nLen;
+	UINT32 nOffset;
+	UINT32 nReserved;
+};
+
+struct RomCacheLru
+{
+	char szName[100];
+	UINT32 nLen;
+};
+
+INT32 nRomCacheLimit = 0;	// in MB, 0 disables the cache
+
+static const char szRomCacheMagic[4] = { 'F', 'B', 'R', 'C' };
+
+static char szCacheDir[MAX_PATH];
+static char szCacheDriver[100];
+static char szCachePath[MAX_PATH];
+static UINT32 nCacheFileLen = 0;
+
+// Current cache file, mapped if the platform allows it, read through stdio otherwise
+static std::vector<RomCacheEntry> CacheEntries;
+static UINT8* pCacheMap = NULL;
+static size_t nCacheMapLen = 0;
+static FILE* fCache = NULL;
+
+// Roms that weren't in the cache, they are written to a temporary file and merged on commit
+static std::vector<RomCacheEntry> NewEntries;
+static FILE* fNew = NULL;
+static UINT32 nNewOffset = 0;
+
+static INT32 nCacheHits = 0;
+
+static const RomCacheEntry* RomCacheFind(const std::vector<RomCacheEntry>& Entries, UINT32 nCrc, UINT32 nLen)
+{
+	for (UINT32 i = 0; i < Entries.size(); i++) {
+		if (Entries[i].nCrc == nCrc && Entries[i].nLen == nLen) {
+			return &Entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+// Returns false if the path doesn't fit, the driver is then left out of the cache
+static bool RomCacheDriverPath(char* szPath, INT32 nPathLen, const char* szDriver)
+{
+	INT32 nRet = snprintf(szPath, nPathLen, "%s%s.romcache", szCacheDir, szDriver);
+
+	return nRet >= 0 && nRet < nPathLen;
+}
+
+static bool RomCacheReadEntry(const RomCacheEntry* pEntry, UINT8* Dest)
+{
+	if (pCacheMap) {
+		memcpy(Dest, pCacheMap + pEntry->nOffset, pEntry->nLen);
+		return true;
+	}
+
+	if (fCache) {
+		if (fseek(fCache, pEntry->nOffset, SEEK_SET) != 0) return false;
+		return fread(Dest, 1, pEntry->nLen, fCache) == pEntry->nLen;
+	}
+
+	return false;
+}
+
+static void RomCacheRelease()
+{
+#ifdef HAVE_MMAN
+	if (pCacheMap) {
+		munmap(pCacheMap, nCacheMapLen);
+	}
+#endif
+	pCacheMap = NULL;
+	nCacheMapLen = 0;
+
+	if (fCache) {
+		fclose(fCache);
+		fCache = NULL;
+	}
+
+	CacheEntries.clear();
+}
+
+static bool RomCacheReadTable(const RomCacheHeader* pHeader, size_t nFileLen)
+{
+	if (memcmp(pHeader->szMagic, szRomCacheMagic, 4) || pHeader->nVersion != ROMCACHE_VERSION) return false;
+	if (pHeader->nTableOffset > nFileLen || (nFileLen - pHeader->nTableOffset) / sizeof(RomCacheEntry) < pHeader->nEntries) return false;
+
+	CacheEntries.resize(pHeader->nEntries);
+	if (pHeader->nEntries == 0) return true;
+
+	if (pCacheMap) {
+		memcpy(&CacheEntries[0], pCacheMap + pHeader->nTableOffset, pHeader->nEntries * sizeof(RomCacheEntry));
+	} else {
+		fseek(fCache, pHeader->nTableOffset, SEEK_SET);
+		UINT32 nTableLen = pHeader->nEntries * sizeof(RomCacheEntry);
+		if (fread(&CacheEntries[0], 1, nTableLen, fCache) != nTableLen) return false;
+	}
+
+	for (UINT32 i = 0; i < CacheEntries.size(); i++) {
+		if (CacheEntries[i].nOffset > nFileLen || nFileLen - CacheEntries[i].nOffset < CacheEntries[i].nLen) return false;
+	}
+
+	return true;
+}
+
+// Move the current driver to the top of the list, then drop the caches that don't fit the limit
+static void RomCacheLruUpdate()
+{
+	char szLruPath[MAX_PATH + 16];
+	snprintf(szLruPath, sizeof(szLruPath), "%sromcache.lru", szCacheDir);
+
+	std::vector<RomCacheLru> List;
+	RomCacheLru Entry;
+	char szLine[128];
+
+	FILE* f = fopen(szLruPath, "r");
+	if (f) {
+		while (fgets(szLine, sizeof(szLine), f)) {
+			if (sscanf(szLine, "%99s %u", Entry.szName, &Entry.nLen) == 2 && strcmp(Entry.szName, szCacheDriver)) {
+				List.push_back(Entry);
+			}
+		}
+		fclose(f);
+	}
+
+	strcpy(Entry.szName, szCacheDriver);
+	Entry.nLen = nCacheFileLen;
+	List.insert(List.begin(), Entry);
+
+	UINT64 nLimit = (UINT64)nRomCacheLimit << 20;
+	UINT64 nTotal = 0;
+
+	for (UINT32 i = 0; i < List.size(); i++) {
+		if (i > 0 && nTotal + List[i].nLen > nLimit) {
+			char szPath[MAX_PATH + 128];
+			if (RomCacheDriverPath(szPath, sizeof(szPath), List[i].szName)) {
+				remove(szPath);
+			}
+			log_cb(RETRO_LOG_INFO, "[FBA] Rom cache of %s removed to stay under %d MB\n", List[i].szName, nRomCacheLimit);
+			List.erase(List.begin() + i--);
+			continue;
+		}
+		nTotal += List[i].nLen;
+	}
+
+	f = fopen(szLruPath, "w");
+	if (f == NULL) return;
+
+	for (UINT32 i = 0; i < List.size(); i++) {
+		fprintf(f, "%s %u\n", List[i].szName, List[i].nLen);
+	}
+	fclose(f);
+}
+
+void RomCacheOpen(const char* szDir, const char* szDriver)
+{
+	RomCacheClose(false);
+
+	if (nRomCacheLimit == 0) return;
+
+	strncpy(szCacheDir, szDir, sizeof(szCacheDir) - 1);
+	szCacheDir[sizeof(szCacheDir) - 1] = '\0';
+	strncpy(szCacheDriver, szDriver, sizeof(szCacheDriver) - 1);
+	szCacheDriver[sizeof(szCacheDriver) - 1] = '\0';
+	if (!RomCacheDriverPath(szCachePath, sizeof(szCachePath), szCacheDriver)) {
+		log_cb(RETRO_LOG_WARN, "[FBA] Rom cache path too long, not caching %s\n", szCacheDriver);
+		szCachePath[0] = '\0';
+		szCacheDriver[0] = '\0';
+		return;
+	}
+
+	RomCacheHeader Header;
+	size_t nFileLen = 0;
+
+#ifdef HAVE_MMAN
+	int fd = open(szCachePath, O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+		if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(Header)) {
+			nFileLen = st.st_size;
+			void* pMap = mmap(NULL, nFileLen, PROT_READ, MAP_SHARED, fd, 0);
+			if (pMap != MAP_FAILED) {
+				pCacheMap = (UINT8*)pMap;
+				nCacheMapLen = nFileLen;
+				memcpy(&Header, pCacheMap, sizeof(Header));
+			}
+		}
+		close(fd);
+	}
+#endif
+
+	if (pCacheMap == NULL) {
+		fCache = fopen(szCachePath, "rb");
+		if (fCache) {
+			fseek(fCache, 0, SEEK_END);
+			nFileLen = ftell(fCache);
+			fseek(fCache, 0, SEEK_SET);
+			if (nFileLen < sizeof(Header) || fread(&Header, 1, sizeof(Header), fCache) != sizeof(Header)) {
+				RomCacheRelease();
+			}
+		}
+	}
+
+	if (pCacheMap == NULL && fCache == NULL) return;
+
+	if (!RomCacheReadTable(&Header, nFileLen)) {
+		log_cb(RETRO_LOG_WARN, "[FBA] Ignoring invalid rom cache %s\n", szCachePath);
+		RomCacheRelease();
+		return;
+	}
+
+	nCacheFileLen = nFileLen;
+
+	log_cb(RETRO_LOG_INFO, "[FBA] Using rom cache %s (%d roms)\n", szCachePath, (INT32)CacheEntries.size());
+}
+
+bool RomCacheLoad(UINT8* Dest, INT32* pnWrote, UINT32 nCrc, UINT32 nLen)
+{
+	if (nRomCacheLimit == 0) return false;
+
+	const RomCacheEntry* pEntry = RomCacheFind(CacheEntries, nCrc, nLen);
+	if (pEntry == NULL || !RomCacheReadEntry(pEntry, Dest)) return false;
+
+	if (pnWrote) *pnWrote = pEntry->nLen;
+	nCacheHits++;
+
+	return true;
+}
+
+static void RomCacheWritePad(FILE* f, UINT32* pnOffset)
+{
+	static const UINT8 Pad[ROMCACHE_ALIGN] = { 0 };
+	UINT32 nPad = (ROMCACHE_ALIGN - (*pnOffset & (ROMCACHE_ALIGN - 1))) & (ROMCACHE_ALIGN - 1);
+	fwrite(Pad, 1, nPad, f);
+	*pnOffset += nPad;
+}
+
+static void RomCacheWrite(const UINT8* Src, UINT32 nCrc, UINT32 nLen)
+{
+	if (fNew == NULL) {
+		char szTemp[MAX_PATH + 4];
+		snprintf(szTemp, sizeof(szTemp), "%s.tmp", szCachePath);
+		fNew = fopen(szTemp, "w+b");
+		if (fNew == NULL) return;
+
+		// The header is rewritten once the table is known
+		RomCacheHeader Header;
+		memset(&Header, 0, sizeof(Header));
+		fwrite(&Header, 1, sizeof(Header), fNew);
+		nNewOffset = sizeof(Header);
+	}
+
+	RomCacheWritePad(fNew, &nNewOffset);
+
+	if (fwrite(Src, 1, nLen, fNew) != nLen) {
+		char szTemp[MAX_PATH + 4];
+		snprintf(szTemp, sizeof(szTemp), "%s.tmp", szCachePath);
+		fclose(fNew);
+		fNew = NULL;
+		remove(szTemp);
+		NewEntries.clear();
+		return;
+	}
+
+	RomCacheEntry Entry = { nCrc, nLen, nNewOffset, 0 };
+	NewEntries.push_back(Entry);
+	nNewOffset += nLen;
+}
+
+void RomCacheStore(const UINT8* Src, UINT32 nCrc, UINT32 nLen)
+{
+	if (nRomCacheLimit == 0 || szCachePath[0] == '\0') return;
+	if (RomCacheFind(CacheEntries, nCrc, nLen) || RomCacheFind(NewEntries, nCrc, nLen)) return;
+
+	// A driver bigger than the whole limit only gets the roms that fit
+	if ((UINT64)nCacheFileLen + nNewOffset + nLen > ((UINT64)nRomCacheLimit << 20)) return;
+
+	RomCacheWrite(Src, nCrc, nLen);
+}
+
+// Write the table and the header, the header goes last so a partial write leaves the old table in use.
+// Sizes are in bytes, the libretro file streams return bytes rather than elements
+static bool RomCacheWriteTable(FILE* f, UINT32 nTableOffset, const std::vector<RomCacheEntry>& Entries)
+{
+	RomCacheHeader Header;
+	memcpy(Header.szMagic, szRomCacheMagic, 4);
+	Header.nVersion = ROMCACHE_VERSION;
+	Header.nEntries = Entries.size();
+	Header.nTableOffset = nTableOffset;
+
+	UINT32 nTableLen = Entries.size() * sizeof(RomCacheEntry);
+	if (fwrite(&Entries[0], 1, nTableLen, f) != nTableLen) return false;
+
+	fseek(f, 0, SEEK_SET);
+	if (fwrite(&Header, 1, sizeof(Header), f) != sizeof(Header)) return false;
+
+	nCacheFileLen = nTableOffset + nTableLen;
+	return true;
+}
+
+// Copy the new roms to the end of the current cache, past its table, then write the whole table
+static bool RomCacheAppend(std::vector<RomCacheEntry>& Entries)
+{
+	FILE* f = fopen(szCachePath, "r+b");
+	if (f == NULL) return false;
+
+	std::vector<UINT8> Buffer;
+	UINT32 nOffset = nCacheFileLen;
+	UINT32 nOldEntries = Entries.size();
+
+	fseek(f, nOffset, SEEK_SET);
+
+	for (UINT32 i = 0; i < NewEntries.size(); i++) {
+		RomCacheEntry Entry = NewEntries[i];
+
+		Buffer.resize(Entry.nLen + 1);
+		fseek(fNew, Entry.nOffset, SEEK_SET);
+		if (fread(&Buffer[0], 1, Entry.nLen, fNew) != Entry.nLen) break;
+
+		RomCacheWritePad(f, &nOffset);
+		if (fwrite(&Buffer[0], 1, Entry.nLen, f) != Entry.nLen) break;
+
+		Entry.nOffset = nOffset;
+		Entries.push_back(Entry);
+		nOffset += Entry.nLen;
+	}
+
+	bool bRet = false;
+
+	if (Entries.size() == nOldEntries + NewEntries.size()) {
+		RomCacheWritePad(f, &nOffset);
+		bRet = RomCacheWriteTable(f, nOffset, Entries);
+	}
+
+	fclose(f);
+	return bRet;
+}
+
+void RomCacheClose(bool bCommit)
+{
+	char szTemp[MAX_PATH + 4];
+	snprintf(szTemp, sizeof(szTemp), "%s.tmp", szCachePath);
+
+	if (fNew) {
+		bool bWritten = false;
+
+		if (bCommit && nCacheFileLen) {
+			// The roms already in the cache aren't rewritten
+			std::vector<RomCacheEntry> Entries = CacheEntries;
+			RomCacheRelease();
+			bWritten = RomCacheAppend(Entries);
+			fclose(fNew);
+			remove(szTemp);
+		} else if (bCommit) {
+			// No usable cache yet, the temporary file becomes the cache
+			RomCacheWritePad(fNew, &nNewOffset);
+			bWritten = RomCacheWriteTable(fNew, nNewOffset, NewEntries);
+			fclose(fNew);
+			RomCacheRelease();
+			remove(szCachePath);
+			if (!bWritten || rename(szTemp, szCachePath) != 0) {
+				bWritten = false;
+				remove(szTemp);
+			}
+		} else {
+			fclose(fNew);
+			remove(szTemp);
+		}
+		fNew = NULL;
+
+		if (bWritten) {
+			log_cb(RETRO_LOG_INFO, "[FBA] Rom cache %s updated with %d roms\n", szCachePath, (INT32)NewEntries.size());
+		} else {
+			nCacheFileLen = 0;
+		}
+	}
+
+	// Used or written caches go to the top of the list, a failed boot doesn't count as a use
+	if (bCommit && nCacheFileLen) {
+		RomCacheLruUpdate();
+	}
+
+	if (nCacheHits) {
+		log_cb(RETRO_LOG_INFO, "[FBA] %d roms loaded from the rom cache\n", nCacheHits);
+	}
+
+	RomCacheRelease();
+	NewEntries.clear();
+	nNewOffset = 0;
+	nCacheHits = 0;
+	nCacheFileLen = 0;
+	szCacheDriver[0] = '\0';
+	szCachePath[0] = '\0';
+}
@@ -0,0 +1,13 @@
+#ifndef __RETRO_ROMCACHE__
+#define __RETRO_ROMCACHE__
+
+#include "burner.h"
+
+extern INT32 nRomCacheLimit;
+
+void RomCacheOpen(const char* szDir, const char* szDriver);
+bool RomCacheLoad(UINT8* Dest, INT32* pnWrote, UINT32 nCrc, UINT32 nLen);
+void RomCacheStore(const UINT8* Src, UINT32 nCrc, UINT32 nLen);
+void RomCacheClose(bool bCommit);
+
+#endif
@@ -0,0 +1,302 @@
+// Save state helpers
+#include "retro_common.h"
+#include "retro_state.h"
+#include "burnint.h"
+
+#include <features/features_cpu.h>
+
+// Areas closer than this to the stack of the scan are locals of the scan functions
+#define STATE_STACK_RANGE	(256 * 1024)
+
+// Number of serializes (on distinct frames) where the area table must match a full scan before it is trusted
+#define STATE_LAYOUT_CHECKS	8
+
+// Area table of the loaded game, so serializing doesn't have to go through the driver scan every time
+enum { LAYOUT_NONE = 0, LAYOUT_CHECK, LAYOUT_CACHED, LAYOUT_DISABLED };
+
+struct StateLayoutArea
+{
+	UINT8* pData;
+	UINT32 nLen;
+};
+
+static std::vector<StateLayoutArea> LayoutAreas;
+static std::vector<UINT8> LayoutCheckBuffer;
+static INT32 nLayoutMode = LAYOUT_NONE;
+static INT32 nLayoutChecks = 0;
+static UINT32 nLayoutSize = 0;
+static UINT32 nLayoutFrame = 0;
+
+static UINT8* pStateWritePtr;
+static UINT32 nLayoutCheckArea;
+
+// Snapshots
+static UINT32 nSnapshotSize = 0;
+static const UINT8* pSnapshotReadPtr;
+static UINT32 nSnapshotLeft;
+static bool bSnapshotMismatch;
+
+// Statistics
+struct StateStats
+{
+	UINT32 nCount;
+	UINT64 nBytes;
+	INT64 nTime;
+};
+
+static StateStats SerializeStats;
+static StateStats UnserializeStats;
+static StateStats SnapshotSaveStats;
+static StateStats SnapshotLoadStats;
+
+static void StateStatsAdd(StateStats* pStats, UINT32 nBytes, INT64 nTime)
+{
+	pStats->nCount++;
+	pStats->nBytes += nBytes;
+	pStats->nTime += nTime;
+}
+
+static INT32 __cdecl StateWriteAcb(struct BurnArea* pba)
+{
+	memcpy(pStateWritePtr, pba->Data, pba->nLen);
+	pStateWritePtr += pba->nLen;
+	return 0;
+}
+
+static INT32 __cdecl StateRecordAcb(struct BurnArea* pba)
+{
+	UINT8 nMarker = 0;
+	ptrdiff_t nDistance = (UINT8*)pba->Data - &nMarker;
+
+	if (nDistance > -STATE_STACK_RANGE && nDistance < STATE_STACK_RANGE) {
+		// a temporary of the scan function, its address won't be valid next time
+		nLayoutMode = LAYOUT_DISABLED;
+	}
+
+	StateLayoutArea Area;
+	Area.pData = (UINT8*)pba->Data;
+	Area.nLen = pba->nLen;
+	LayoutAreas.push_back(Area);
+
+	return StateWriteAcb(pba);
+}
+
+static INT32 __cdecl StateCheckAcb(struct BurnArea* pba)
+{
+	if (nLayoutCheckArea >= LayoutAreas.size() || LayoutAreas[nLayoutCheckArea].pData != pba->Data || LayoutAreas[nLayoutCheckArea].nLen != pba->nLen) {
+		nLayoutMode = LAYOUT_DISABLED;
+	}
+	nLayoutCheckArea++;
+
+	return StateWriteAcb(pba);
+}
+
+// Copy the areas in the table to pDst
+static void StateLayoutCopy(UINT8* pDst)
+{
+	for (UINT32 i = 0; i < LayoutAreas.size(); i++) {
+		memcpy(pDst, LayoutAreas[i].pData, LayoutAreas[i].nLen);
+		pDst += LayoutAreas[i].nLen;
+	}
+}
+
+void StateLayoutReset()
+{
+	LayoutAreas.clear();
+	LayoutCheckBuffer.clear();
+	nLayoutMode = LAYOUT_NONE;
+	nLayoutChecks = 0;
+	nLayoutSize = 0;
+	nSnapshotSize = 0;
+}
+
+// Write the state of the game to pDst, nSize is the size returned by the dummy scan
+// Only drivers which called BurnAreaScanSetStatic() use the list of areas, the others always go through the scan.
+// The first time the list of areas is recorded, then a number of serializes compare it with a full scan: the area
+// contents are copied from the table *before* the scan, so a scan which packs data into the areas on ACB_READ (or
+// passes different areas) is caught as long as the game runs between the serializes.
+// Unserializing always goes through the driver scan, as the drivers restore banking etc. in their ACB_WRITE code.
+void StateWrite(UINT8* pDst, UINT32 nSize)
+{
+	if (nLayoutMode == LAYOUT_CACHED && nLayoutSize == nSize) {
+		// as BurnAreaScan() does, the sound chips rendered on a worker must be idle while they are copied
+		BurnSoundQueueSyncAll();
+		StateLayoutCopy(pDst);
+		return;
+	}
+
+	if (nLayoutSize != nSize) {
+		StateLayoutReset();
+		nLayoutSize = nSize;
+	}
+
+	if (!BurnAreaScanIsStatic()) {
+		nLayoutMode = LAYOUT_DISABLED;
+	}
+
+	INT32 nPrevMode = nLayoutMode;
+
+	pStateWritePtr = pDst;
+
+	switch (nLayoutMode) {
+		case LAYOUT_NONE: {
+			nLayoutFrame = nCurrentFrame;
+			nLayoutMode = LAYOUT_CHECK;
+			BurnAcb = StateRecordAcb;
+			BurnAreaScan(ACB_FULLSCAN | ACB_READ, 0);
+			break;
+		}
+
+		case LAYOUT_CHECK: {
+			bool bNewFrame = (nLayoutFrame != nCurrentFrame);
+			nLayoutFrame = nCurrentFrame;
+
+			LayoutCheckBuffer.resize(nSize);
+			StateLayoutCopy(&LayoutCheckBuffer[0]);
+
+			nLayoutCheckArea = 0;
+			BurnAcb = StateCheckAcb;
+			BurnAreaScan(ACB_FULLSCAN | ACB_READ, 0);
+
+			if (nLayoutMode == LAYOUT_CHECK && (nLayoutCheckArea != LayoutAreas.size() || memcmp(pDst, &LayoutCheckBuffer[0], nSize))) {
+				nLayoutMode = LAYOUT_DISABLED;
+			}
+
+			if (nLayoutMode == LAYOUT_CHECK && bNewFrame && ++nLayoutChecks >= STATE_LAYOUT_CHECKS) {
+				nLayoutMode = LAYOUT_CACHED;
+				LayoutCheckBuffer.clear();
+			}
+			break;
+		}
+
+		default: {
+			BurnAcb = StateWriteAcb;
+			BurnAreaScan(ACB_FULLSCAN | ACB_READ, 0);
+			break;
+		}
+	}
+
+	if (nLayoutMode != nPrevMode) {
+		if (nLayoutMode == LAYOUT_DISABLED) {
+			log_cb(RETRO_LOG_INFO, "[FBA] Save state areas can't be cached for this game\n");
+			LayoutAreas.clear();
+			LayoutCheckBuffer.clear();
+		} else if (nLayoutMode == LAYOUT_CACHED) {
+			log_cb(RETRO_LOG_INFO, "[FBA] Save state areas cached (%u areas)\n", (UINT32)LayoutAreas.size());
+		}
+	}
+}
+
+static INT32 __cdecl StateSizeAcb(struct BurnArea* pba)
+{
+	nSnapshotSize += pba->nLen;
+	return 0;
+}
+
+static INT32 __cdecl StateSnapshotReadAcb(struct BurnArea* pba)
+{
+	if (pba->nLen > nSnapshotLeft) {
+		bSnapshotMismatch = true;
+		return 0;
+	}
+
+	memcpy(pba->Data, pSnapshotReadPtr, pba->nLen);
+	pSnapshotReadPtr += pba->nLen;
+	nSnapshotLeft -= pba->nLen;
+
+	return 0;
+}
+
+// Unlike retro_serialize(), the size is only computed when the game (or its layout) changes
+bool StateSnapshotSave(StateSnapshot* pState)
+{
+	retro_time_t nStart = cpu_features_get_time_usec();
+
+	if (nSnapshotSize == 0) {
+		BurnAcb = StateSizeAcb;
+		BurnAreaScan(ACB_FULLSCAN, 0);
+		if (nSnapshotSize == 0) {
+			return false;
+		}
+	}
+
+	UINT32 nSize = nSnapshotSize;
+	if (pState->Data.size() != nSize) {
+		pState->Data.resize(nSize);
+	}
+
+	StateWrite(&pState->Data[0], nSize);
+	pState->bValid = true;
+
+	StateStatsAdd(&SnapshotSaveStats, nSize, cpu_features_get_time_usec() - nStart);
+
+	return true;
+}
+
+bool StateSnapshotLoad(StateSnapshot* pState)
+{
+	if (!pState->bValid || pState->Data.size() != nSnapshotSize) {
+		return false;
+	}
+
+	retro_time_t nStart = cpu_features_get_time_usec();
+
+	pSnapshotReadPtr = &pState->Data[0];
+	nSnapshotLeft = pState->Data.size();
+	bSnapshotMismatch = false;
+
+	// The driver scan still runs, it rebuilds whatever depends on the restored data (banks, etc.)
+	BurnAcb = StateSnapshotReadAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, 0);
+	BurnRecalcPal();
+
+	StateStatsAdd(&SnapshotLoadStats, pState->Data.size(), cpu_features_get_time_usec() - nStart);
+
+	if (bSnapshotMismatch || nSnapshotLeft) {
+		log_cb(RETRO_LOG_WARN, "[FBA] State snapshot doesn't match the driver anymore\n");
+		pState->bValid = false;
+		return false;
+	}
+
+	return true;
+}
+
+void StateSnapshotFree(StateSnapshot* pState)
+{
+	std::vector<UINT8>().swap(pState->Data);
+	pState->bValid = false;
+}
+
+static void StateStatsPrint(const char* szWhat, const StateStats* pStats)
+{
+	if (pStats->nCount == 0) return;
+
+	log_cb(RETRO_LOG_INFO, "[FBA] %s: %u calls, %u bytes in %lld us per call\n", szWhat, pStats->nCount,
+		(UINT32)(pStats->nBytes / pStats->nCount), (long long)(pStats->nTime / pStats->nCount));
+}
+
+void StateStatsSerialize(UINT32 nBytes, INT64 nTime)
+{
+	StateStatsAdd(&SerializeStats, nBytes, nTime);
+}
+
+void StateStatsUnserialize(UINT32 nBytes, INT64 nTime)
+{
+	StateStatsAdd(&UnserializeStats, nBytes, nTime);
+}
+
+void StateStatsLog()
+{
+	StateStatsPrint("Serialize", &SerializeStats);
+	StateStatsPrint("Unserialize", &UnserializeStats);
+	StateStatsPrint("Snapshot save", &SnapshotSaveStats);
+	StateStatsPrint("Snapshot load", &SnapshotLoadStats);
+}
+
+void StateStatsReset()
+{
+	memset(&SerializeStats, 0, sizeof(SerializeStats));
+	memset(&UnserializeStats, 0, sizeof(UnserializeStats));
+	memset(&SnapshotSaveStats, 0, sizeof(SnapshotSaveStats));
+	memset(&SnapshotLoadStats, 0, sizeof(SnapshotLoadStats));
+}
@@ -0,0 +1,29 @@
+#ifndef __RETRO_STATE__
+#define __RETRO_STATE__
+
+#include <vector>
+
+#include "burner.h"
+
+void StateWrite(UINT8* pDst, UINT32 nSize);
+void StateLayoutReset();
+
+// In-memory state of the game, for run-ahead
+struct StateSnapshot
+{
+	std::vector<UINT8> Data;
+	bool bValid;
+
+	StateSnapshot() : bValid(false) {}
+};
+
+bool StateSnapshotSave(StateSnapshot* pState);
+bool StateSnapshotLoad(StateSnapshot* pState);
+void StateSnapshotFree(StateSnapshot* pState);
+
+void StateStatsSerialize(UINT32 nBytes, INT64 nTime);
+void StateStatsUnserialize(UINT32 nBytes, INT64 nTime);
+void StateStatsLog();
+void StateStatsReset();
+
+#endif
@@ -0,0 +1,261 @@
+// Worker threads for the emulator (BurnThreadRun, BurnThreadStart)
+#include "retro_common.h"
+#include "retro_threads.h"
+
+UINT32 nRenderThreads = 1;
+
+#ifdef HAVE_THREADS
+
+#include <rthreads/rthreads.h>
+
+#define MAX_THREADS		8
+
+static sthread_t* pThreads[MAX_THREADS];
+static UINT32 nThreads = 0;
+
+static slock_t* pLock = NULL;
+static scond_t* pCondStart = NULL;
+static scond_t* pCondDone = NULL;
+
+// Current batch, everything is protected by pLock
+static void (*pJobFn)(void*, INT32) = NULL;
+static void* pJobParam = NULL;
+static INT32 nJobsTotal = 0;
+static INT32 nJobNext = 0;
+static INT32 nJobsDone = 0;
+static UINT32 nGeneration = 0;
+static bool bQuit = false;
+
+// Runs jobs of the current batch until none are left, called with pLock held
+static void ThreadsTakeJobs()
+{
+	while (nJobNext < nJobsTotal) {
+		INT32 nJob = nJobNext++;
+
+		slock_unlock(pLock);
+		pJobFn(pJobParam, nJob);
+		slock_lock(pLock);
+
+		if (++nJobsDone == nJobsTotal) {
+			scond_signal(pCondDone);
+		}
+	}
+}
+
+static void ThreadsWorker(void*)
+{
+	UINT32 nSeen = 0;
+
+	slock_lock(pLock);
+	while (1) {
+		while (!bQuit && nSeen == nGeneration) {
+			scond_wait(pCondStart, pLock);
+		}
+		if (bQuit) {
+			break;
+		}
+		nSeen = nGeneration;
+		ThreadsTakeJobs();
+	}
+	slock_unlock(pLock);
+}
+
+static void __cdecl ThreadsRun(void (*pJob)(void* pParam, INT32 nJob), void* pParam, INT32 nJobs)
+{
+	slock_lock(pLock);
+
+	pJobFn = pJob;
+	pJobParam = pParam;
+	nJobsTotal = nJobs;
+	nJobNext = 0;
+	nJobsDone = 0;
+	nGeneration++;
+	scond_broadcast(pCondStart);
+
+	// the emulation thread takes its share too
+	ThreadsTakeJobs();
+	while (nJobsDone < nJobsTotal) {
+		scond_wait(pCondDone, pLock);
+	}
+
+	slock_unlock(pLock);
+}
+
+void ThreadsExit()
+{
+	BurnThreadRun = NULL;
+	nBurnThreads = 1;
+
+	if (pLock == NULL) {
+		return;
+	}
+
+	slock_lock(pLock);
+	bQuit = true;
+	scond_broadcast(pCondStart);
+	slock_unlock(pLock);
+
+	for (UINT32 i = 0; i < nThreads; i++) {
+		sthread_join(pThreads[i]);
+		pThreads[i] = NULL;
+	}
+	nThreads = 0;
+
+	scond_free(pCondDone);
+	scond_free(pCondStart);
+	slock_free(pLock);
+	pCondDone = pCondStart = NULL;
+	pLock = NULL;
+}
+
+void ThreadsInit(UINT32 nCount)
+{
+	if (nCount > MAX_THREADS) {
+		nCount = MAX_THREADS;
+	}
+	if (nCount < 1) {
+		nCount = 1;
+	}
+	if (nCount == nThreads + 1) {
+		return;
+	}
+
+	ThreadsExit();
+
+	if (nCount <= 1) {
+		return;
+	}
+
+	pLock = slock_new();
+	pCondStart = scond_new();
+	pCondDone = scond_new();
+	if (pLock == NULL || pCondStart == NULL || pCondDone == NULL) {
+		log_cb(RETRO_LOG_WARN, "[FBA] Couldn't create the worker threads, rendering on one thread\n");
+		if (pCondDone) scond_free(pCondDone);
+		if (pCondStart) scond_free(pCondStart);
+		if (pLock) slock_free(pLock);
+		pCondDone = pCondStart = NULL;
+		pLock = NULL;
+		return;
+	}
+
+	bQuit = false;
+	nGeneration = 0;
+
+	for (UINT32 i = 0; i < nCount - 1; i++) {
+		pThreads[nThreads] = sthread_create(ThreadsWorker, NULL);
+		if (pThreads[nThreads] == NULL) {
+			break;
+		}
+		nThreads++;
+	}
+
+	if (nThreads == 0) {
+		log_cb(RETRO_LOG_WARN, "[FBA] Couldn't create the worker threads, rendering on one thread\n");
+		ThreadsExit();
+		return;
+	}
+
+	BurnThreadRun = ThreadsRun;
+	nBurnThreads = nThreads + 1;
+
+	log_cb(RETRO_LOG_INFO, "[FBA] Rendering on %d threads\n", nBurnThreads);
+}
+
+// Thread and event hooks for the sound chips rendered on a thread of their own (BurnSoundQueue)
+struct RetroEvent {
+	slock_t* pLock;
+	scond_t* pCond;
+	bool bSet;
+};
+
+static void* __cdecl RetroThreadStart(void (*pFn)(void* pParam), void* pParam)
+{
+	return sthread_create(pFn, pParam);
+}
+
+static void __cdecl RetroThreadJoin(void* pThread)
+{
+	sthread_join((sthread_t*)pThread);
+}
+
+static void __cdecl RetroEventFree(void* pEvent)
+{
+	RetroEvent* pRetroEvent = (RetroEvent*)pEvent;
+
+	if (pRetroEvent->pCond) scond_free(pRetroEvent->pCond);
+	if (pRetroEvent->pLock) slock_free(pRetroEvent->pLock);
+	free(pRetroEvent);
+}
+
+static void* __cdecl RetroEventNew()
+{
+	RetroEvent* pRetroEvent = (RetroEvent*)calloc(1, sizeof(RetroEvent));
+	if (pRetroEvent == NULL) {
+		return NULL;
+	}
+
+	pRetroEvent->pLock = slock_new();
+	pRetroEvent->pCond = scond_new();
+	if (pRetroEvent->pLock == NULL || pRetroEvent->pCond == NULL) {
+		RetroEventFree(pRetroEvent);
+		return NULL;
+	}
+
+	return pRetroEvent;
+}
+
+static void __cdecl RetroEventSet(void* pEvent)
+{
+	RetroEvent* pRetroEvent = (RetroEvent*)pEvent;
+
+	slock_lock(pRetroEvent->pLock);
+	pRetroEvent->bSet = true;
+	scond_signal(pRetroEvent->pCond);
+	slock_unlock(pRetroEvent->pLock);
+}
+
+static void __cdecl RetroEventWait(void* pEvent)
+{
+	RetroEvent* pRetroEvent = (RetroEvent*)pEvent;
+
+	slock_lock(pRetroEvent->pLock);
+	while (!pRetroEvent->bSet) {
+		scond_wait(pRetroEvent->pCond, pRetroEvent->pLock);
+	}
+	pRetroEvent->bSet = false;
+	slock_unlock(pRetroEvent->pLock);
+}
+
+void ThreadsSetSound(bool bEnable)
+{
+	BurnThreadStart = RetroThreadStart;
+	BurnThreadJoin = RetroThreadJoin;
+	BurnEventNew = RetroEventNew;
+	BurnEventFree = RetroEventFree;
+	BurnEventSet = RetroEventSet;
+	BurnEventWait = RetroEventWait;
+
+	bBurnSoundThread = bEnable;
+}
+
+#else
+
+void ThreadsSetSound(bool)
+{
+	bBurnSoundThread = false;
+}
+
+void ThreadsInit(UINT32)
+{
+	BurnThreadRun = NULL;
+	nBurnThreads = 1;
+}
+
+void ThreadsExit()
+{
+	BurnThreadRun = NULL;
+	nBurnThreads = 1;
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef __RETRO_THREADS__
+#define __RETRO_THREADS__
+
+#include "burner.h"
+
+// Number of threads used for rendering (the emulation thread included)
+extern UINT32 nRenderThreads;
+
+// Starts nThreads - 1 worker threads and hooks them to BurnThreadRun,
+// with 1 (or without thread support) everything runs on the emulation thread
+void ThreadsInit(UINT32 nThreads);
+void ThreadsExit();
+
+// Sets the thread and event hooks of the core and bBurnSoundThread (sound chips rendered on
+// a thread of their own, from the next game loaded)
+void ThreadsSetSound(bool bEnable);
+
+#endif
@@ -10,15 +10,72 @@
 #define ZIPFN_FILETYPE_ZIP		1
 #define ZIPFN_FILETYPE_7ZIP		2
 
+#define ZIPFN_MAX_PARKED		64
+
 static INT32 nFileType = ZIPFN_FILETYPE_NONE;
 
 static unzFile Zip = NULL;
 static INT32 nCurrFile = 0; // The current file we are pointing to
 
+// Directory positions of every entry, filled in by ZipGetList() so ZipLoadFile() can seek straight to an entry
+static unz_file_pos* pFilePos = NULL;
+static INT32 nFilePosCount = 0;
+
 #ifdef INCLUDE_7Z_SUPPORT
 static _7z_file* _7ZipFile = NULL;
 #endif
 
+// State of an open archive, used to park it while another archive is current
+struct ZipHandle {
+	INT32 nFileType;
+	unzFile Zip;
+	INT32 nCurrFile;
+	unz_file_pos* pFilePos;
+	INT32 nFilePosCount;
+#ifdef INCLUDE_7Z_SUPPORT
+	_7z_file* _7ZipFile;
+#endif
+};
+
+static ZipHandle ParkedHandles[ZIPFN_MAX_PARKED];
+static bool bParked[ZIPFN_MAX_PARKED];
+
+static void ZipSaveHandle(ZipHandle* pHandle)
+{
+	pHandle->nFileType = nFileType;
+	pHandle->Zip = Zip;
+	pHandle->nCurrFile = nCurrFile;
+	pHandle->pFilePos = pFilePos;
+	pHandle->nFilePosCount = nFilePosCount;
+#ifdef INCLUDE_7Z_SUPPORT
+	pHandle->_7ZipFile = _7ZipFile;
+#endif
+}
+
+static void ZipRestoreHandle(const ZipHandle* pHandle)
+{
+	nFileType = pHandle->nFileType;
+	Zip = pHandle->Zip;
+	nCurrFile = pHandle->nCurrFile;
+	pFilePos = pHandle->pFilePos;
+	nFilePosCount = pHandle->nFilePosCount;
+#ifdef INCLUDE_7Z_SUPPORT
+	_7ZipFile = pHandle->_7ZipFile;
+#endif
+}
+
+static void ZipResetHandle()
+{
+	nFileType = ZIPFN_FILETYPE_NONE;
+	Zip = NULL;
+	nCurrFile = 0;
+	pFilePos = NULL;
+	nFilePosCount = 0;
+#ifdef INCLUDE_7Z_SUPPORT
+	_7ZipFile = NULL;
+#endif
+}
+
 INT32 ZipOpen(char* szZip)
 {
 	nFileType = ZIPFN_FILETYPE_NONE;
@@ -69,11 +126,64 @@ INT32 ZipClose()
 	}
 #endif
 	
+	if (pFilePos) {
+		free(pFilePos);
+		pFilePos = NULL;
+	}
+	nFilePosCount = 0;
+
 	nFileType = ZIPFN_FILETYPE_NONE;
 	
 	return 0;
 }
 
+// Detach the current archive (with its parsed directory) and keep it open in slot nSlot
+INT32 ZipPark(INT32 nSlot)
+{
+	if (nSlot < 0 || nSlot >= ZIPFN_MAX_PARKED) return 1;
+	if (nFileType == ZIPFN_FILETYPE_NONE) return 1;
+	if (bParked[nSlot]) return 1;
+
+	ZipSaveHandle(&ParkedHandles[nSlot]);
+	bParked[nSlot] = true;
+	ZipResetHandle();
+
+	return 0;
+}
+
+// Make the archive parked in slot nSlot the current one again, the current archive must be closed or parked first
+INT32 ZipUnpark(INT32 nSlot)
+{
+	if (nSlot < 0 || nSlot >= ZIPFN_MAX_PARKED) return 1;
+	if (nFileType != ZIPFN_FILETYPE_NONE) return 1;
+	if (!bParked[nSlot]) return 1;
+
+	ZipRestoreHandle(&ParkedHandles[nSlot]);
+	bParked[nSlot] = false;
+
+	return 0;
+}
+
+// Close every parked archive, the current archive is left untouched
+INT32 ZipCloseParked()
+{
+	ZipHandle Current;
+	ZipSaveHandle(&Current);
+
+	for (INT32 i = 0; i < ZIPFN_MAX_PARKED; i++) {
+		if (!bParked[i]) continue;
+
+		ZipRestoreHandle(&ParkedHandles[i]);
+		ZipClose();
+
+		bParked[i] = false;
+	}
+
+	ZipRestoreHandle(&Current);
+
+	return 0;
+}
+
 // Get the contents of a zip file into an array of ZipEntrys
 INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount)
 {
@@ -99,6 +209,10 @@ INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount)
 		INT32 nRet = unzGoToFirstFile(Zip);
 		if (nRet != UNZ_OK) { unzClose(Zip); free(List); List = NULL; return 1; }
 
+		if (pFilePos) free(pFilePos);
+		pFilePos = (unz_file_pos *)malloc(nListLen * sizeof(unz_file_pos));
+		nFilePosCount = 0;
+
 		// Step through all of the files, until we get to the end
 		INT32 nNextRet = 0;
 
@@ -109,6 +223,11 @@ INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount)
 			unz_file_info FileInfo;
 			memset(&FileInfo, 0, sizeof(FileInfo));
 
+			if (pFilePos && unzGetFilePos(Zip, &pFilePos[nCurrFile]) != UNZ_OK) {
+				free(pFilePos);
+				pFilePos = NULL;
+			}
+
 			nRet = unzGetCurrentFileInfo(Zip, &FileInfo, NULL, 0, NULL, 0, NULL, 0);
 			if (nRet != UNZ_OK) continue;
 
@@ -124,6 +243,9 @@ INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount)
 			List[nCurrFile].nCrc = FileInfo.crc;
 		}
 
+		// Only the entries stepped through have a saved position, the directory may end early
+		if (pFilePos) nFilePosCount = nCurrFile;
+
 		// return the file list
 		*pList = List;
 		if (pnListCount != NULL) *pnListCount = nListLen;
@@ -207,7 +329,14 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 	INT32 nRet = 0;
 	
 	if (nFileType == ZIPFN_FILETYPE_ZIP) {
-		if (nEntry < nCurrFile)
+		if (nEntry >= 0 && nEntry < nFilePosCount)
+		{
+			// We know where the entry lives, jump straight to it
+			nRet = unzGoToFilePos(Zip, &pFilePos[nEntry]);
+			if (nRet != UNZ_OK) return 1;
+			nCurrFile = nEntry;
+		}
+		else if (nEntry < nCurrFile)
 		{
 			// We'll have to go through the zip file again to get to our entry
 			nRet = unzGoToFirstFile(Zip);
@@ -258,7 +387,7 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 }
 
 // Load one file directly, added by regret
-INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote)
+static INT32 ZipLoadOneFileInternal(char* arcName, const char* fileName, void** Dest, INT32* pnWrote)
 {
 	if (ZipOpen(arcName)) {
 		return 1;
@@ -398,3 +527,110 @@ INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, I
 
 	return 0;
 }
+
+INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote)
+{
+	// Don't disturb an archive the caller still has open (e.g. samples loaded in the middle of rom loading)
+	ZipHandle Current;
+	ZipSaveHandle(&Current);
+	ZipResetHandle();
+
+	INT32 nRet = ZipLoadOneFileInternal(arcName, fileName, Dest, pnWrote);
+
+	ZipRestoreHandle(&Current);
+
+	return nRet;
+}
+
+// An archive kept open on its own, next to the current and parked archives, so single files
+// can be loaded from it at any time (e.g. samples decoded on first use)
+struct ZipArchive {
+	ZipHandle Handle;
+	struct ZipEntry* pList;
+	INT32 nListCount;
+};
+
+struct ZipArchive* ZipArchiveOpen(char* szZip)
+{
+	ZipHandle Current;
+	ZipSaveHandle(&Current);
+	ZipResetHandle();
+
+	struct ZipArchive* pArchive = NULL;
+
+	if (ZipOpen(szZip) == 0) {
+		pArchive = (struct ZipArchive*)malloc(sizeof(struct ZipArchive));
+		if (pArchive == NULL) {
+			ZipClose();
+		} else {
+			memset(pArchive, 0, sizeof(struct ZipArchive));
+			if (ZipGetList(&pArchive->pList, &pArchive->nListCount) == 0) {
+				ZipSaveHandle(&pArchive->Handle);
+			} else {
+				// ZipGetList() closes a zip when it fails
+				if (nFileType == ZIPFN_FILETYPE_ZIP) {
+					ZipResetHandle();
+				} else {
+					ZipClose();
+				}
+				free(pArchive);
+				pArchive = NULL;
+			}
+		}
+	}
+
+	ZipRestoreHandle(&Current);
+
+	return pArchive;
+}
+
+// Index of the entry called szName, or -1 if the archive doesn't have it
+INT32 ZipArchiveFind(struct ZipArchive* pArchive, const char* szName, UINT32* pnLen, UINT32* pnCrc)
+{
+	if (pArchive == NULL) return -1;
+
+	for (INT32 i = 0; i < pArchive->nListCount; i++) {
+		if (pArchive->pList[i].szName && !stricmp(pArchive->pList[i].szName, szName)) {
+			if (pnLen) *pnLen = pArchive->pList[i].nLen;
+			if (pnCrc) *pnCrc = pArchive->pList[i].nCrc;
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+INT32 ZipArchiveLoadFile(struct ZipArchive* pArchive, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
+{
+	if (pArchive == NULL) return 1;
+
+	ZipHandle Current;
+	ZipSaveHandle(&Current);
+	ZipRestoreHandle(&pArchive->Handle);
+
+	INT32 nRet = ZipLoadFile(Dest, nLen, pnWrote, nEntry);
+
+	ZipSaveHandle(&pArchive->Handle);
+	ZipRestoreHandle(&Current);
+
+	return nRet;
+}
+
+INT32 ZipArchiveClose(struct ZipArchive* pArchive)
+{
+	if (pArchive == NULL) return 0;
+
+	ZipHandle Current;
+	ZipSaveHandle(&Current);
+	ZipRestoreHandle(&pArchive->Handle);
+	ZipClose();
+	ZipRestoreHandle(&Current);
+
+	for (INT32 i = 0; i < pArchive->nListCount; i++) {
+		free(pArchive->pList[i].szName);
+	}
+	free(pArchive->pList);
+	free(pArchive);
+
+	return 0;
+}
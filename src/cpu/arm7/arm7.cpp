@@ -91,6 +91,9 @@ static int ARM7_ICOUNT;
 static int total_cycles = 0;
 static int curr_cycles = 0;
 
+/* idle loop detection slot of the cpu, -1 when it isn't watched (arm7_intf.cpp) */
+extern INT32 nArm7IdleSlot;
+
 void Arm7Open(int ) 
 {
 
@@ -128,6 +131,28 @@ void Arm7BurnCycles(int cycles)
 	arm7_icount -= cycles;
 }
 
+// End the timeslice as if it was run (idle loop detection, see burn_idle.cpp)
+INT32 Arm7IdleSkip()
+{
+	INT32 cycles = ARM7_ICOUNT > 0 ? ARM7_ICOUNT : 0;
+
+	ARM7_ICOUNT = 0;
+
+	return cycles;
+}
+
+// Registers of all modes and the status registers, less the pc (idle loop detection)
+UINT32 Arm7IdleState()
+{
+	UINT32 hash = 0;
+
+	for (int i = 0; i < kNumRegisters; i++) {
+		if (i != eR15) hash = BurnIdleHash(hash, ARM7REG(i));
+	}
+
+	return hash;
+}
+
 INT32 Arm7Idle(int cycles)
 {
 #if defined FBA_DEBUG
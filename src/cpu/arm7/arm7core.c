@@ -137,6 +137,7 @@ ARM7_INLINE void arm7_cpu_write32(UINT32 addr, UINT32 data)
 {
 	addr &= ~3;
 	Arm7WriteLong(addr, data);
+	if (nArm7IdleSlot >= 0) BurnIdleWrite(nArm7IdleSlot);
 }
 
 
@@ -144,11 +145,13 @@ ARM7_INLINE void arm7_cpu_write16(UINT32 addr, UINT16 data)
 {
 	addr &= ~1;
 	Arm7WriteWord(addr, data);
+	if (nArm7IdleSlot >= 0) BurnIdleWrite(nArm7IdleSlot);
 }
 
 ARM7_INLINE void arm7_cpu_write8(UINT32 addr, UINT8 data)
 {
 	Arm7WriteByte(addr, data);
+	if (nArm7IdleSlot >= 0) BurnIdleWrite(nArm7IdleSlot);
 }
 
 ARM7_INLINE UINT32 arm7_cpu_read32(UINT32 addr)
@@ -165,6 +168,8 @@ ARM7_INLINE UINT32 arm7_cpu_read32(UINT32 addr)
         result = Arm7ReadLong(addr);
     }
 
+    if (nArm7IdleSlot >= 0) BurnIdleRead(nArm7IdleSlot, addr, result);
+
     return result;
 }
 
@@ -179,6 +184,8 @@ ARM7_INLINE UINT16 arm7_cpu_read16(UINT32 addr)
         result = ((result >> 8) & 0xff) | ((result & 0xff) << 8);
     }
 
+    if (nArm7IdleSlot >= 0) BurnIdleRead(nArm7IdleSlot, addr, result);
+
     return result;
 }
 
@@ -186,6 +193,8 @@ ARM7_INLINE UINT8 arm7_cpu_read8(UINT32 addr)
 {
 	UINT8 result = Arm7ReadByte(addr);
 
+	if (nArm7IdleSlot >= 0) BurnIdleRead(nArm7IdleSlot, addr, result);
+
     // Handle through normal 8 bit handler (for 32 bit cpu)
     return result;
 }
@@ -28,7 +28,11 @@ static UINT8  (*pReadByteHandler)(UINT32) = NULL;
 
 static UINT32 Arm7IdleLoop = ~0;
 
+INT32 nArm7IdleSlot = -1;			// idle loop detection slot (see burn_idle.cpp)
+
 extern void arm7_set_irq_line(INT32 irqline, INT32 state);
+extern INT32 Arm7IdleSkip();
+extern UINT32 Arm7IdleState();
 
 cpu_core_config Arm7Config =
 {
@@ -43,7 +47,9 @@ cpu_core_config Arm7Config =
 	Arm7RunEnd,
 	Arm7Reset,
 	0x80000000,
-	0
+	0,
+	Arm7IdleSkip,
+	Arm7IdleState
 };
 
 INT32 Arm7GetActive()
@@ -65,6 +71,7 @@ void Arm7Exit() // only one cpu supported
 	}
 
 	Arm7IdleLoop = ~0;
+	nArm7IdleSlot = -1;
 	
 	DebugCPU_ARM7Initted = 0;
 }
@@ -294,6 +301,10 @@ UINT16 Arm7FetchWord(UINT32 addr)
 		Arm7RunEnd();
 	}
 
+	if (nArm7IdleSlot >= 0) {
+		BurnIdleFetch(nArm7IdleSlot, addr);
+	}
+
 	if (membase[FETCH][addr >> PAGE_SHIFT] != NULL) {
 		return *((UINT16*)(membase[FETCH][addr >> PAGE_SHIFT] + (addr & PAGE_WORD_AND)));
 	}
@@ -323,6 +334,10 @@ UINT32 Arm7FetchLong(UINT32 addr)
 		Arm7RunEnd();
 	}
 
+	if (nArm7IdleSlot >= 0) {
+		BurnIdleFetch(nArm7IdleSlot, addr);
+	}
+
 	if (membase[FETCH][addr >> PAGE_SHIFT] != NULL) {
 		return *((UINT32*)(membase[FETCH][addr >> PAGE_SHIFT] + (addr & PAGE_LONG_AND)));
 	}
@@ -395,4 +410,6 @@ void Arm7Init( INT32 nCPU ) // only one cpu supported
 	}
 
 	CpuCheatRegister(nCPU, &Arm7Config);
+
+	nArm7IdleSlot = BurnIdleRegister(&Arm7Config, "ARM7", nCPU);
 }
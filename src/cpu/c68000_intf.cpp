@@ -525,6 +525,9 @@ static INT32 SekInitCPUC68K(INT32 nCount, INT32 nCPUType)
 
 	nSekCPUType[nCount] = nCPUType;
 
+	// the context is packed into cyclone_buffer when it is scanned
+	BurnAreaScanSetDynamic();
+
 	if (!bCycloneInited) {
 #if defined (FBA_DEBUG)
 		bprintf(PRINT_NORMAL, _T("EMU_C68K: CycloneInit\n"));
@@ -16,6 +16,13 @@ INT32 nSekCyclesTotal, nSekCyclesScanline, nSekCyclesSegment, nSekCyclesDone, nS
 
 INT32 nSekCPUType[SEK_MAX], nSekCycles[SEK_MAX], nSekIRQPending[SEK_MAX];
 
+#ifdef EMU_M68K
+static INT32 nSekIdleSlot[SEK_MAX];						// idle loop detection slot of each cpu (see burn_idle.cpp)
+
+static INT32 SekIdleSkip();
+static UINT32 SekIdleState();
+#endif
+
 cpu_core_config SekConfig =
 {
 	SekOpen,
@@ -29,7 +36,14 @@ cpu_core_config SekConfig =
 	SekRunEnd,
 	SekReset,
 	0x1000000,
-	0
+	0,
+#ifdef EMU_M68K
+	SekIdleSkip,
+	SekIdleState
+#else
+	NULL,
+	NULL
+#endif
 };
 
 #if defined (FBA_DEBUG)
@@ -220,6 +234,17 @@ DEFLONGHANDLERS(0)
 // Mapped Memory lookup (+ SEK_WADD * 2 for fetch)
 #define FIND_F(x) pSekExt->MemMap[(x >> SEK_SHIFT) + SEK_WADD * 2]
 
+// Handler profile (bBurnHandlerProfile): accesses that fell through to the handlers, per cpu and handler
+#define SEK_PROFILE_FETCH	0
+#define SEK_PROFILE_READ	1
+#define SEK_PROFILE_WRITE	2
+
+static bool bSekProfile = false;
+static UINT32 nSekProfileFrame = 0;
+static UINT64 nSekProfileCalls[SEK_MAX][3][SEK_MAXHANDLER];
+
+#define SEK_PROFILE(t, pr)	if (bSekProfile) nSekProfileCalls[nSekActive][t][(uintptr_t)pr]++
+
 // Normal memory access functions
 inline static UINT8 ReadByte(UINT32 a)
 {
@@ -234,6 +259,7 @@ inline static UINT8 ReadByte(UINT32 a)
 		a ^= 1;
 		return pr[a & SEK_PAGEM];
 	}
+	SEK_PROFILE(SEK_PROFILE_READ, pr);
 	return pSekExt->ReadByte[(uintptr_t)pr](a);
 }
 
@@ -250,6 +276,7 @@ inline static UINT8 FetchByte(UINT32 a)
 		a ^= 1;
 		return pr[a & SEK_PAGEM];
 	}
+	SEK_PROFILE(SEK_PROFILE_FETCH, pr);
 	return pSekExt->ReadByte[(uintptr_t)pr](a);
 }
 
@@ -267,6 +294,7 @@ inline static void WriteByte(UINT32 a, UINT8 d)
 		pr[a & SEK_PAGEM] = (UINT8)d;
 		return;
 	}
+	SEK_PROFILE(SEK_PROFILE_WRITE, pr);
 	pSekExt->WriteByte[(uintptr_t)pr](a, d);
 }
 
@@ -306,6 +334,7 @@ inline static UINT16 ReadWord(UINT32 a)
 		}
 	}
 
+	SEK_PROFILE(SEK_PROFILE_READ, pr);
 	return pSekExt->ReadWord[(uintptr_t)pr](a);
 }
 
@@ -322,6 +351,7 @@ inline static UINT16 FetchWord(UINT32 a)
 		return BURN_ENDIAN_SWAP_INT16(*((UINT16*)(pr + (a & SEK_PAGEM))));
 	}
 
+	SEK_PROFILE(SEK_PROFILE_FETCH, pr);
 	return pSekExt->ReadWord[(uintptr_t)pr](a);
 }
 
@@ -354,6 +384,7 @@ inline static void WriteWord(UINT32 a, UINT16 d)
 		}
 	}
 
+	SEK_PROFILE(SEK_PROFILE_WRITE, pr);
 	pSekExt->WriteWord[(uintptr_t)pr](a, d);
 }
 
@@ -405,6 +436,7 @@ inline static UINT32 ReadLong(UINT32 a)
 		}
 	}
 
+	SEK_PROFILE(SEK_PROFILE_READ, pr);
 	return pSekExt->ReadLong[(uintptr_t)pr](a);
 }
 
@@ -422,6 +454,7 @@ inline static UINT32 FetchLong(UINT32 a)
 		r = (r >> 16) | (r << 16);
 		return BURN_ENDIAN_SWAP_INT32(r);
 	}
+	SEK_PROFILE(SEK_PROFILE_FETCH, pr);
 	return pSekExt->ReadLong[(uintptr_t)pr](a);
 }
 
@@ -457,6 +490,7 @@ inline static void WriteLong(UINT32 a, UINT32 d)
 			return;
 		}
 	}
+	SEK_PROFILE(SEK_PROFILE_WRITE, pr);
 	pSekExt->WriteLong[(uintptr_t)pr](a, d);
 }
 
@@ -655,9 +689,19 @@ void __fastcall A68KChangePC(UINT32 pc)
 
 #ifdef EMU_M68K
 extern "C" {
-UINT32 __fastcall M68KReadByte(UINT32 a) { return (UINT32)ReadByte(a); }
-UINT32 __fastcall M68KReadWord(UINT32 a) { return (UINT32)ReadWord(a); }
-UINT32 __fastcall M68KReadLong(UINT32 a) { return               ReadLong(a); }
+UINT8** M68KMemMap = NULL;								// pSekExt->MemMap, for the inline paths in m68kconf.h
+
+INT32 nSekIdle = -1;								// idle loop detection slot of the active cpu, -1 when it isn't watched
+
+// Called before every instruction while nSekIdle is set (M68K_INSTRUCTION_CALLBACK in m68kconf.h)
+void M68KIdleFetch(unsigned int pc) { BurnIdleFetch(nSekIdle, pc); }
+
+#define SEK_IDLE_READ(a, d)	if (nSekIdle >= 0) BurnIdleRead(nSekIdle, a, d)
+#define SEK_IDLE_WRITE()	if (nSekIdle >= 0) BurnIdleWrite(nSekIdle)
+
+UINT32 __fastcall M68KReadByte(UINT32 a) { UINT32 d = ReadByte(a); SEK_IDLE_READ(a, d); return d; }
+UINT32 __fastcall M68KReadWord(UINT32 a) { UINT32 d = ReadWord(a); SEK_IDLE_READ(a, d); return d; }
+UINT32 __fastcall M68KReadLong(UINT32 a) { UINT32 d = ReadLong(a); SEK_IDLE_READ(a, d); return d; }
 
 UINT32 __fastcall M68KFetchByte(UINT32 a) { return (UINT32)FetchByte(a); }
 UINT32 __fastcall M68KFetchWord(UINT32 a) { return (UINT32)FetchWord(a); }
@@ -684,9 +728,36 @@ void (__fastcall *M68KWriteWordDebug)(UINT32, UINT32);
 void (__fastcall *M68KWriteLongDebug)(UINT32, UINT32);
 #endif
 
-void __fastcall M68KWriteByte(UINT32 a, UINT32 d) { WriteByte(a, d); }
-void __fastcall M68KWriteWord(UINT32 a, UINT32 d) { WriteWord(a, d); }
-void __fastcall M68KWriteLong(UINT32 a, UINT32 d) { WriteLong(a, d); }
+void __fastcall M68KWriteByte(UINT32 a, UINT32 d) { WriteByte(a, d); SEK_IDLE_WRITE(); }
+void __fastcall M68KWriteWord(UINT32 a, UINT32 d) { WriteWord(a, d); SEK_IDLE_WRITE(); }
+void __fastcall M68KWriteLong(UINT32 a, UINT32 d) { WriteLong(a, d); SEK_IDLE_WRITE(); }
+}
+
+#ifdef M68K_FAST_MEMORY
+// The inline paths in m68kconf.h have their own copy of the page layout
+typedef char M68KFastLayoutCheck[(M68K_FAST_BITS == SEK_BITS && M68K_FAST_MAXHANDLER == SEK_MAXHANDLER && M68K_FAST_WADD == SEK_WADD) ? 1 : -1];
+#endif
+
+// End the timeslice of the active cpu as if it was run (cpu_core_config.skip)
+static INT32 SekIdleSkip()
+{
+	INT32 nCycles = m68k_ICount > 0 ? m68k_ICount : 0;
+
+	m68k_ICount = 0;
+
+	return nCycles;
+}
+
+// Data and address registers and the status register of the active cpu (cpu_core_config.state)
+static UINT32 SekIdleState()
+{
+	UINT32 nHash = m68k_get_reg(NULL, M68K_REG_SR);
+
+	for (INT32 i = M68K_REG_D0; i <= M68K_REG_A7; i++) {
+		nHash = BurnIdleHash(nHash, m68k_get_reg(NULL, (m68k_register_t)i));
+	}
+
+	return nHash;
 }
 #endif
 
@@ -864,6 +935,9 @@ static INT32 SekInitCPUA68K(INT32 nCount, INT32 nCPUType)
 
 	nSekCPUType[nCount] = 0;
 
+	// the callback pointers are blanked when the context is scanned
+	BurnAreaScanSetDynamic();
+
 	// Allocate emu-specific cpu states
 	SekRegs[nCount] = (struct A68KContext*)malloc(sizeof(struct A68KContext));
 	if (SekRegs[nCount] == NULL) {
@@ -940,6 +1014,39 @@ UINT8 SekCheatRead(UINT32 a)
 	return SekReadByte(a);
 }
 
+// Print the handler profile of the cpus, for finding boards that spend their time in handlers
+static void SekProfileExit()
+{
+	if (!bSekProfile) {
+		return;
+	}
+
+	bSekProfile = false;
+
+	UINT32 nFrames = nCurrentFrame - nSekProfileFrame;
+	if (nFrames == 0) {
+		return;
+	}
+
+	static const TCHAR* szAccess[3] = { _T("fetch"), _T("read"), _T("write") };
+
+	bprintf(PRINT_IMPORTANT, _T("68000 handler calls of %hs in %u frames (per frame):\n"), BurnDrvGetTextA(DRV_NAME), nFrames);
+
+	for (INT32 i = 0; i <= nSekCount; i++) {
+		for (INT32 j = 0; j < SEK_MAXHANDLER; j++) {
+			if (nSekProfileCalls[i][0][j] + nSekProfileCalls[i][1][j] + nSekProfileCalls[i][2][j] == 0) {
+				continue;
+			}
+
+			bprintf(PRINT_IMPORTANT, _T("  #%d handler %d:"), i, j);
+			for (INT32 k = 0; k < 3; k++) {
+				bprintf(PRINT_IMPORTANT, _T(" %5s %.0f"), szAccess[k], (double)nSekProfileCalls[i][k][j] / nFrames);
+			}
+			bprintf(PRINT_IMPORTANT, _T("\n"));
+		}
+	}
+}
+
 INT32 SekInit(INT32 nCount, INT32 nCPUType)
 {
 	DebugCPU_SekInitted = 1;
@@ -955,6 +1062,12 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 		nSekActive = -1;
 	}
 
+	if (nSekCount < 0) {									// first cpu
+		bSekProfile = bBurnHandlerProfile;
+		nSekProfileFrame = nCurrentFrame;
+		memset(nSekProfileCalls, 0, sizeof(nSekProfileCalls));
+	}
+
 	if (nCount > nSekCount) {
 		nSekCount = nCount;
 	}
@@ -1084,6 +1197,14 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 
 	CpuCheatRegister(nCount, &SekConfig);
 
+#ifdef EMU_M68K
+	nSekIdleSlot[nCount] = -1;
+#ifdef EMU_A68K
+	if (nSekCPUType[nCount] != 0)
+#endif
+		nSekIdleSlot[nCount] = BurnIdleRegister(&SekConfig, "68000", nCount);
+#endif
+
 	return 0;
 }
 
@@ -1115,6 +1236,8 @@ INT32 SekExit()
 
 	if (!DebugCPU_SekInitted) return 1;
 
+	SekProfileExit();
+
 	// Deallocate cpu extenal data (memory map etc)
 	for (INT32 i = 0; i <= nSekCount; i++) {
 
@@ -1137,6 +1260,11 @@ INT32 SekExit()
 
 	nSekActive = -1;
 	nSekCount = -1;
+
+#ifdef EMU_M68K
+	M68KMemMap = NULL;
+	nSekIdle = -1;
+#endif
 	
 	DebugCPU_SekInitted = 0;
 
@@ -1196,6 +1324,8 @@ void SekOpen(const INT32 i)
 
 #ifdef EMU_M68K
 			m68k_set_context(SekM68KContext[nSekActive]);
+			M68KMemMap = pSekExt->MemMap;
+			nSekIdle = nSekIdleSlot[nSekActive];
 #endif
 
 #ifdef EMU_A68K
@@ -1222,6 +1352,7 @@ void SekClose()
 
 #ifdef EMU_M68K
 		m68k_get_context(SekM68KContext[nSekActive]);
+		nSekIdle = -1;
 #endif
 
 #ifdef EMU_A68K
@@ -153,14 +153,16 @@
 
 
 /* If ON, CPU will call the instruction hook callback before every
- * instruction.
+ * instruction.  FBA links it to the idle loop detection, which only costs
+ * a test of nSekIdle while it is off, and debug builds also call the
+ * callback set for breakpoints.
  */
+#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
 #ifdef FBA_DEBUG
- #define M68K_INSTRUCTION_HOOK       OPT_ON
+ #define M68K_INSTRUCTION_CALLBACK(pc) { CALLBACK_INSTR_HOOK(pc); if (nSekIdle >= 0) M68KIdleFetch(pc); }
 #else
- #define M68K_INSTRUCTION_HOOK       OPT_OFF
+ #define M68K_INSTRUCTION_CALLBACK(pc) if (nSekIdle >= 0) M68KIdleFetch(pc)
 #endif
-#define M68K_INSTRUCTION_CALLBACK() your_instruction_hook_function()
 
 
 /* If ON, the CPU will emulate the 4-byte prefetch queue of a real 68000 */
@@ -223,6 +225,9 @@ void M68KRTECallback(void);
 void M68KcmpildCallback(unsigned int val, int reg);
 int M68KTASCallback(void);
 
+extern int nSekIdle;
+void M68KIdleFetch(unsigned int pc);
+
 unsigned int __fastcall M68KFetchByte(unsigned int a);
 unsigned int __fastcall M68KFetchWord(unsigned int a);
 unsigned int __fastcall M68KFetchLong(unsigned int a);
@@ -249,12 +254,117 @@ void __fastcall M68KWriteWord(unsigned int a, unsigned int d);
 void __fastcall M68KWriteLong(unsigned int a, unsigned int d);
 #endif
 
+/* Memory map of the open cpu (SekExt::MemMap), for the inline paths below */
+extern unsigned char **M68KMemMap;
+
 #ifdef __cplusplus
  }
 #endif
 
 #define m68ki_remaining_cycles m68k_ICount
 
+/* Release builds on little endian hosts read and write the pages mapped with
+ * SekMapMemory() inline, the way ReadWord() etc. in m68000_intf.cpp do, and
+ * only call out for handlers, odd addresses and cpus watched by the idle loop
+ * detection.  The page layout must match SEK_BITS and SEK_MAXHANDLER in
+ * m68000_intf.h (checked there).
+ */
+#if !defined FBA_DEBUG && defined LSB_FIRST
+#define M68K_FAST_MEMORY
+
+#include <stddef.h>
+
+#define M68K_FAST_BITS       10
+#define M68K_FAST_PAGEM      ((1 << M68K_FAST_BITS) - 1)
+#define M68K_FAST_WADD       (1 << (24 - M68K_FAST_BITS))
+#define M68K_FAST_MAXHANDLER 10
+
+#define M68K_FAST_PAGE(address, section) M68KMemMap[(((address) & 0xffffff) >> M68K_FAST_BITS) + (section) * M68K_FAST_WADD]
+#define M68K_FAST_MAPPED(p)              ((size_t)(p) >= M68K_FAST_MAXHANDLER)
+
+INLINE unsigned int M68KFastReadByte(unsigned int a)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 0);
+	if (M68K_FAST_MAPPED(p) && nSekIdle < 0)
+		return p[(a ^ 1) & M68K_FAST_PAGEM];
+	return M68KReadByte(a);
+}
+
+INLINE unsigned int M68KFastReadWord(unsigned int a)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 0);
+	if (M68K_FAST_MAPPED(p) && (a & 1) == 0 && nSekIdle < 0)
+		return *(unsigned short *)(p + (a & M68K_FAST_PAGEM));
+	return M68KReadWord(a);
+}
+
+INLINE unsigned int M68KFastReadLong(unsigned int a)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 0);
+	if (M68K_FAST_MAPPED(p) && (a & 1) == 0 && nSekIdle < 0) {
+		unsigned int r = *(unsigned int *)(p + (a & M68K_FAST_PAGEM));
+		return (r >> 16) | (r << 16);
+	}
+	return M68KReadLong(a);
+}
+
+INLINE void M68KFastWriteByte(unsigned int a, unsigned int d)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 1);
+	if (M68K_FAST_MAPPED(p) && nSekIdle < 0) {
+		p[(a ^ 1) & M68K_FAST_PAGEM] = (unsigned char)d;
+		return;
+	}
+	M68KWriteByte(a, d);
+}
+
+INLINE void M68KFastWriteWord(unsigned int a, unsigned int d)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 1);
+	if (M68K_FAST_MAPPED(p) && (a & 1) == 0 && nSekIdle < 0) {
+		*(unsigned short *)(p + (a & M68K_FAST_PAGEM)) = (unsigned short)d;
+		return;
+	}
+	M68KWriteWord(a, d);
+}
+
+INLINE void M68KFastWriteLong(unsigned int a, unsigned int d)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 1);
+	if (M68K_FAST_MAPPED(p) && (a & 1) == 0 && nSekIdle < 0) {
+		*(unsigned int *)(p + (a & M68K_FAST_PAGEM)) = (d >> 16) | (d << 16);
+		return;
+	}
+	M68KWriteLong(a, d);
+}
+
+INLINE unsigned int M68KFastFetchWord(unsigned int a)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 2);
+	if (M68K_FAST_MAPPED(p))
+		return *(unsigned short *)(p + (a & M68K_FAST_PAGEM));
+	return M68KFetchWord(a);
+}
+
+INLINE unsigned int M68KFastFetchLong(unsigned int a)
+{
+	unsigned char *p = M68K_FAST_PAGE(a, 2);
+	if (M68K_FAST_MAPPED(p)) {
+		unsigned int r = *(unsigned int *)(p + (a & M68K_FAST_PAGEM));
+		return (r >> 16) | (r << 16);
+	}
+	return M68KFetchLong(a);
+}
+
+/* Read data relative to the PC */
+#define m68k_read_pcrelative_8(address) M68KFetchByte(address)
+#define m68k_read_pcrelative_16(address) M68KFastFetchWord(address)
+#define m68k_read_pcrelative_32(address) M68KFastFetchLong(address)
+
+/* Read data immediately following the PC */
+#define m68k_read_immediate_16(address) M68KFastFetchWord(address)
+#define m68k_read_immediate_32(address) M68KFastFetchLong(address)
+#else
 /* Read data relative to the PC */
 #define m68k_read_pcrelative_8(address) M68KFetchByte(address)
 #define m68k_read_pcrelative_16(address) M68KFetchWord(address)
@@ -263,6 +373,7 @@ void __fastcall M68KWriteLong(unsigned int a, unsigned int d);
 /* Read data immediately following the PC */
 #define m68k_read_immediate_16(address) M68KFetchWord(address)
 #define m68k_read_immediate_32(address) M68KFetchLong(address)
+#endif
 
 /* Memory access for the disassembler */
 #define m68k_read_disassembler_8(address) SekDbgFetchByteDisassembler(address)
@@ -279,6 +390,16 @@ void __fastcall M68KWriteLong(unsigned int a, unsigned int d);
 #define m68k_write_memory_8(address, value) M68KWriteByteDebug(address, value)
 #define m68k_write_memory_16(address, value) M68KWriteWordDebug(address, value)
 #define m68k_write_memory_32(address, value) M68KWriteLongDebug(address, value)
+#elif defined M68K_FAST_MEMORY
+/* Read from anywhere */
+#define m68k_read_memory_8(address) M68KFastReadByte(address)
+#define m68k_read_memory_16(address) M68KFastReadWord(address)
+#define m68k_read_memory_32(address) M68KFastReadLong(address)
+
+/* Write to anywhere */
+#define m68k_write_memory_8(address, value) M68KFastWriteByte(address, value)
+#define m68k_write_memory_16(address, value) M68KFastWriteWord(address, value)
+#define m68k_write_memory_32(address, value) M68KFastWriteLong(address, value)
 #else
 /* Read from anywhere */
 #define m68k_read_memory_8(address) M68KReadByte(address)
@@ -31,12 +31,27 @@
 
 #include "burnint.h"
 #include "sh2_intf.h"
+#include "sh2_internal.h"
 #include <stddef.h>
 
+#ifdef SH2_X64_DRC
+#include "x64/sh2_x64.h"
+#endif
+
 int has_sh2;
 INT32 cps3speedhack; // must be set _after_ Sh2Init();
 INT32 sh2_busyloop_speedhack_mode2;
 
+#ifdef SH2_X64_DRC
+INT32 sh2_drc_mode = SH2_DRC_ON;
+
+static INT32 nSh2DrcChecked;	// lockstep mode statistics
+static INT32 nSh2DrcSkipped;
+static INT32 nSh2DrcErrors;
+#else
+INT32 sh2_drc_mode = SH2_DRC_OFF;
+#endif
+
 #define BUSY_LOOP_HACKS     1
 #define FAST_OP_FETCH		1
 #define USE_JUMPTABLE		0
@@ -63,64 +78,6 @@ INT32 sh2_busyloop_speedhack_mode2;
 
 #define COMBINE_DATA(varptr)		(*(varptr) = (*(varptr) & mem_mask) | (data & ~mem_mask))
 
-
-
-typedef struct
-{
-	INT32 irq_vector;
-	INT32 irq_priority;
-} irq_entry;
-
-typedef struct
-{
-	UINT32	ppc;
-	UINT32	pc;
-	UINT32	pr;
-	UINT32	sr;
-	UINT32	gbr, vbr;
-	UINT32	mach, macl;
-	UINT32	r[16];
-	UINT32	ea;
-	UINT32	delay;
-	UINT32	cpu_off;
-	UINT32	dvsr, dvdnth, dvdntl, dvcr;
-	UINT32	pending_irq;
-	UINT32    test_irq;
-	irq_entry     irq_queue[16];
-
-	INT8	irq_line_state[17];
-	UINT32	m[0x200];
-	INT8  nmi_line_state;
-
-	UINT16 	frc;
-	UINT16 	ocra, ocrb, icr;
-	UINT32 	frc_base;
-
-	INT32	frt_input;
-	INT32 	internal_irq_level;
-	INT32 	internal_irq_vector;
-
-//	emu_timer *timer;
-	UINT32 	timer_cycles;
-	UINT32 	timer_base;
-	INT32   timer_active;
-	
-//	emu_timer *dma_timer[2];
-	UINT32 	dma_timer_cycles[2];
-	UINT32 	dma_timer_base[2];
-	INT32   dma_timer_active[2];
-
-//	int     is_slave, cpu_number;
-	
-	UINT32	cycle_counts; // used internally for timers / sh2_GetTotalCycles()
-	UINT32	sh2_cycles_to_run;
-	INT32	sh2_icount;
-	INT32   sh2_total_cycles; // used externally (drivers/etc)
-	INT32   sh2_eat_cycles;
-
-	int 	(*irq_callback)(int irqline);
-} SH2;
-
 static SH2 * sh2;
 
 static UINT32 sh2_GetTotalCycles()
@@ -145,7 +102,7 @@ enum {
 #define Q	0x00000100
 #define M	0x00000200
 
-#define AM	0xc7ffffff
+#define AM	SH2_AM
 
 #define FLAGS	(M|Q|I|S|T)
 
@@ -157,32 +114,6 @@ static void sh2_internal_w(UINT32 offset, UINT32 data, UINT32 mem_mask);
 
 //-- sh2 memory handler for Finalburn Alpha ---------------------
 
-#define SH2_BITS		(16)					// 16 = 0x10000 page size
-#define SH2_PAGE_COUNT  (1 << (32 - SH2_BITS))	// Number of pages
-#define SH2_SHIFT		(SH2_BITS)				// Shift value = page bits
-#define SH2_PAGE_SIZE	(1 << SH2_BITS)			// Page size
-#define SH2_PAGEM		(SH2_PAGE_SIZE - 1)
-#define SH2_WADD		(SH2_PAGE_COUNT)		// Value to add for write section = Number of pages
-#define SH2_MASK		(SH2_WADD - 1)
-
-#define	SH2_MAXHANDLER	(8)
-
-
-typedef struct 
-{
-	SH2	sh2;
-	unsigned char * MemMap[SH2_PAGE_COUNT * 3];
-	pSh2ReadByteHandler ReadByte[SH2_MAXHANDLER];
-	pSh2WriteByteHandler WriteByte[SH2_MAXHANDLER];
-	pSh2ReadWordHandler ReadWord[SH2_MAXHANDLER];
-	pSh2WriteWordHandler WriteWord[SH2_MAXHANDLER];
-	pSh2ReadLongHandler ReadLong[SH2_MAXHANDLER];
-	pSh2WriteLongHandler WriteLong[SH2_MAXHANDLER];
-	
-	unsigned char * opbase;
-	int suspend;
-} SH2EXT;
-
 static SH2EXT * pSh2Ext;
 static SH2EXT * Sh2Ext = NULL;
 
@@ -261,6 +192,11 @@ int Sh2MapMemory(unsigned char* pMemory, unsigned int nStart, unsigned int nEnd,
 			}
 		}
 	}
+
+#ifdef SH2_X64_DRC
+	Sh2DrcFlush();
+#endif
+
 	return 0;
 }
 
@@ -309,6 +245,11 @@ int Sh2MapHandler(uintptr_t nHandler, unsigned int nStart, unsigned int nEnd, in
 		}
 		
 	}
+
+#ifdef SH2_X64_DRC
+	Sh2DrcFlush();
+#endif
+
 	return 0;
 }
 
@@ -454,6 +395,13 @@ int Sh2Exit()
 
 	has_sh2 = 0;
 
+#ifdef SH2_X64_DRC
+	if (sh2_drc_mode == SH2_DRC_LOCKSTEP && (nSh2DrcChecked || nSh2DrcSkipped)) {
+		bprintf(PRINT_IMPORTANT, _T("SH-2 recompiler lockstep: %d blocks checked, %d skipped (memory handlers, modified code), %d mismatches\n"), nSh2DrcChecked, nSh2DrcSkipped, nSh2DrcErrors);
+	}
+	Sh2DrcExit();
+#endif
+
 	if (Sh2Ext) {
 		free(Sh2Ext);
 		Sh2Ext = NULL;
@@ -491,6 +439,14 @@ int Sh2Init(int nCount)
 	}
 	memset(Sh2Ext, 0, sizeof(SH2EXT) * nCount);
 
+#ifdef SH2_X64_DRC
+	nSh2DrcChecked = nSh2DrcSkipped = nSh2DrcErrors = 0;
+	if (Sh2DrcInit(nCount)) {
+		Sh2Exit();
+		return 1;
+	}
+#endif
+
 	// init default memory handler
 	for (int i=0; i<nCount; i++) {
 		pSh2Ext = Sh2Ext + i;
@@ -636,6 +592,66 @@ SH2_INLINE unsigned short cpu_readop16(unsigned int A)
 
 // ------------------------------------------------------
 
+#ifdef SH2_X64_DRC
+
+// lockstep mode (see Sh2DrcLockstep()): the interpreter logs its ram writes so they can be undone, and
+// notes when it goes through a memory handler, as a handler can't be run twice
+
+#define SH2_JOURNAL_MAX		256
+
+struct sh2_journal_entry {
+	UINT8* pMem;
+	INT32 nSize;
+	UINT32 nOld;
+	UINT32 nNew;
+};
+
+static sh2_journal_entry Sh2Journal[SH2_JOURNAL_MAX];
+static INT32 nSh2JournalCount;
+static INT32 bSh2Journal;
+static INT32 bSh2JournalHandler;
+
+static inline UINT32 Sh2JournalRead(UINT8* pMem, INT32 nSize)
+{
+	switch (nSize) {
+		case 1: return *pMem;
+		case 2: return *((UINT16*)pMem);
+	}
+	return *((UINT32*)pMem);
+}
+
+static inline void Sh2JournalStore(UINT8* pMem, INT32 nSize, UINT32 nData)
+{
+	switch (nSize) {
+		case 1: *pMem = (UINT8)nData; break;
+		case 2: *((UINT16*)pMem) = (UINT16)nData; break;
+		case 4: *((UINT32*)pMem) = nData; break;
+	}
+}
+
+static void Sh2JournalWrite(UINT8* pMem, INT32 nSize)
+{
+	if (nSh2JournalCount == SH2_JOURNAL_MAX) {
+		bSh2JournalHandler = 1;			// can't be undone, treated like a handler access
+		return;
+	}
+
+	Sh2Journal[nSh2JournalCount].pMem = pMem;
+	Sh2Journal[nSh2JournalCount].nSize = nSize;
+	Sh2Journal[nSh2JournalCount].nOld = Sh2JournalRead(pMem, nSize);
+	nSh2JournalCount++;
+}
+
+#define SH2_JOURNAL_WRITE(p, n)		if (bSh2Journal) Sh2JournalWrite(p, n);
+#define SH2_JOURNAL_HANDLER()		bSh2JournalHandler = 1;
+
+#else
+
+#define SH2_JOURNAL_WRITE(p, n)
+#define SH2_JOURNAL_HANDLER()
+
+#endif
+
 SH2_INLINE UINT8 RB(UINT32 A)
 {
 /*	if (A >= 0xe0000000) return sh2_internal_r((A & 0x1fc)>>2, ~(0xff << (((~A) & 3)*8))) >> (((~A) & 3)*8);
@@ -651,6 +667,7 @@ SH2_INLINE UINT8 RB(UINT32 A)
 #endif
 		return pr[A & SH2_PAGEM];
 	}
+	SH2_JOURNAL_HANDLER();
 	return pSh2Ext->ReadByte[(uintptr_t)pr](A);
 }
 
@@ -670,6 +687,7 @@ SH2_INLINE UINT16 RW(UINT32 A)
 		//return (pr[A & SH2_PAGEM] << 8) | pr[(A & SH2_PAGEM) + 1];
 		return *((unsigned short *)(pr + (A & SH2_PAGEM)));
 	}
+	SH2_JOURNAL_HANDLER();
 	return pSh2Ext->ReadWord[(uintptr_t)pr](A);
 }
 
@@ -701,6 +719,7 @@ SH2_INLINE UINT32 RL(UINT32 A)
 		//return (pr[(A & SH2_PAGEM) + 0] << 24) | (pr[(A & SH2_PAGEM) + 1] << 16) | (pr[(A & SH2_PAGEM) + 2] <<  8) | (pr[(A & SH2_PAGEM) + 3] <<  0);
 		return *((unsigned int *)(pr + (A & SH2_PAGEM)));
 	}
+	SH2_JOURNAL_HANDLER();
 	return pSh2Ext->ReadLong[(uintptr_t)pr](A);
 }
 
@@ -717,9 +736,11 @@ SH2_INLINE void WB(UINT32 A, UINT8 V)
 #ifdef LSB_FIRST
 		A ^= 3;
 #endif
+		SH2_JOURNAL_WRITE(pr + (A & SH2_PAGEM), 1);
 		pr[A & SH2_PAGEM] = (unsigned char)V;
 		return;
 	}
+	SH2_JOURNAL_HANDLER();
 	pSh2Ext->WriteByte[(uintptr_t)pr](A, V);
 }
 
@@ -736,9 +757,11 @@ SH2_INLINE void WW(UINT32 A, UINT16 V)
 #ifdef LSB_FIRST
 		A ^= 2;
 #endif
+		SH2_JOURNAL_WRITE(pr + (A & SH2_PAGEM), 2);
 		*((unsigned short *)(pr + (A & SH2_PAGEM))) = (unsigned short)V;
 		return;
 	}
+	SH2_JOURNAL_HANDLER();
 	pSh2Ext->WriteWord[(uintptr_t)pr](A, V);
 }
 
@@ -751,9 +774,11 @@ SH2_INLINE void WL(UINT32 A, UINT32 V)
 	unsigned char * pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
+		SH2_JOURNAL_WRITE(pr + (A & SH2_PAGEM), 4);
 		*((unsigned int *)(pr + (A & SH2_PAGEM))) = (unsigned int)V;
 		return;
 	}
+	SH2_JOURNAL_HANDLER();
 	pSh2Ext->WriteLong[(uintptr_t)pr](A, V);
 }
 
@@ -3253,6 +3278,222 @@ static UINT32 sh2_internal_r(UINT32 offset, UINT32 /*mem_mask*/)
 
 // -------------------------------------------------------
 
+static inline void Sh2Execute(UINT16 opcode)
+{
+	switch (opcode & ( 15 << 12))
+	{
+		case  0<<12: op0000(opcode); break;
+		case  1<<12: op0001(opcode); break;
+		case  2<<12: op0010(opcode); break;
+		case  3<<12: op0011(opcode); break;
+		case  4<<12: op0100(opcode); break;
+		case  5<<12: op0101(opcode); break;
+		case  6<<12: op0110(opcode); break;
+		case  7<<12: op0111(opcode); break;
+		case  8<<12: op1000(opcode); break;
+		case  9<<12: op1001(opcode); break;
+		case 10<<12: op1010(opcode); break;
+		case 11<<12: op1011(opcode); break;
+		case 12<<12: op1100(opcode); break;
+		case 13<<12: op1101(opcode); break;
+		case 14<<12: op1110(opcode); break;
+	default: op1111(opcode); break;
+	}
+}
+
+static inline void Sh2Step()
+{
+	UINT16 opcode;
+
+	if (sh2->delay) {
+		opcode = cpu_readop16(sh2->delay & AM);
+		change_pc(sh2->pc & AM);
+		sh2->delay = 0;
+	} else {
+		opcode = cpu_readop16(sh2->pc & AM);
+		sh2->pc += 2;
+	}
+
+	sh2->ppc = sh2->pc;
+
+	Sh2Execute(opcode);
+}
+
+static inline void Sh2CheckIrq()
+{
+	if(sh2->test_irq && !sh2->delay)
+	{
+		CHECK_PENDING_IRQ(/*"mame_sh2_execute"*/);
+		sh2->test_irq = 0;
+	}
+}
+
+static inline void Sh2CheckTimers()
+{
+	unsigned int cy = sh2_GetTotalCycles();
+
+	if (sh2->dma_timer_active[0])
+		if ((cy - sh2->dma_timer_base[0]) >= sh2->dma_timer_cycles[0])
+			sh2_dmac_callback(0);
+
+	if (sh2->dma_timer_active[1])
+		if ((cy - sh2->dma_timer_base[1]) >= sh2->dma_timer_cycles[1])
+			sh2_dmac_callback(1);
+
+	if ( sh2->timer_active )
+		if ((cy - sh2->timer_base) >= sh2->timer_cycles)
+			sh2_timer_callback();
+}
+
+#ifdef SH2_X64_DRC
+
+void Sh2DrcInterpret(UINT32 opcode)
+{
+	Sh2Execute(opcode);
+}
+
+// cycles a block can take: it has to end before sh2_icount runs out and before a dma or timer event is due,
+// as those are only checked between blocks
+static INT32 Sh2DrcBudget()
+{
+	INT32 nBudget = sh2->sh2_icount;
+	UINT32 cy = sh2_GetTotalCycles();
+
+	for (INT32 i = 0; i < 2; i++) {
+		if (sh2->dma_timer_active[i]) {
+			UINT32 nElapsed = cy - sh2->dma_timer_base[i];
+			INT32 nLeft = (nElapsed >= sh2->dma_timer_cycles[i]) ? 0 : (INT32)(sh2->dma_timer_cycles[i] - nElapsed);
+			if (nLeft < nBudget) nBudget = nLeft;
+		}
+	}
+
+	if (sh2->timer_active) {
+		UINT32 nElapsed = cy - sh2->timer_base;
+		INT32 nLeft = (nElapsed >= sh2->timer_cycles) ? 0 : (INT32)(sh2->timer_cycles - nElapsed);
+		if (nLeft < nBudget) nBudget = nLeft;
+	}
+
+	return nBudget;
+}
+
+static void Sh2DrcMismatch(UINT32 nPc, const TCHAR* pszWhat, UINT32 nInterp, UINT32 nDrc)
+{
+	if (nSh2DrcErrors++ < 16) {
+		bprintf(PRINT_ERROR, _T("SH-2 recompiler: block %08x, %s is %08x, the interpreter has %08x\n"), nPc, pszWhat, nDrc, nInterp);
+	}
+}
+
+// Runs the block on the interpreter, undoes it, runs the compiled code and compares the two. The
+// interpreter's result is kept either way. Blocks that go through a memory handler can't be run twice,
+// those are only interpreted.
+static INT32 Sh2DrcLockstep(Sh2DrcBlock* pBlock)
+{
+	static SH2 Start, Ref;
+
+	INT32 (*pCode)(SH2EXT*) = pBlock->pCode;		// a handler can flush the cache under the block
+	INT32 nCount = pBlock->nCount;
+	INT32 nCpu = pSh2Ext - Sh2Ext;
+	UINT32 nPc = sh2->pc;
+	INT32 nSuspend = pSh2Ext->suspend;
+
+	memcpy(&Start, sh2, sizeof(SH2));
+
+	nSh2JournalCount = 0;
+	bSh2JournalHandler = 0;
+	bSh2Journal = 1;
+	for (INT32 i = 0; i < nCount && !bSh2JournalHandler; i++) {
+		Sh2Step();
+		sh2->sh2_total_cycles++;
+		sh2->sh2_icount -= sh2->sh2_eat_cycles;
+	}
+	bSh2Journal = 0;
+
+	if (bSh2JournalHandler) {
+		nSh2DrcSkipped++;
+		Sh2CheckIrq();
+		return 1;
+	}
+
+	memcpy(&Ref, sh2, sizeof(SH2));
+	INT32 nRefSuspend = pSh2Ext->suspend;
+	for (INT32 i = 0; i < nSh2JournalCount; i++) {
+		Sh2Journal[i].nNew = Sh2JournalRead(Sh2Journal[i].pMem, Sh2Journal[i].nSize);
+	}
+	for (INT32 i = nSh2JournalCount - 1; i >= 0; i--) {
+		Sh2JournalStore(Sh2Journal[i].pMem, Sh2Journal[i].nSize, Sh2Journal[i].nOld);
+	}
+
+	memcpy(sh2, &Start, sizeof(SH2));
+	pSh2Ext->suspend = nSuspend;
+
+	INT32 nExit = pCode(pSh2Ext);
+
+	if (nExit == SH2_DRC_EXIT_MODIFIED) {
+		Sh2DrcInvalidate(nCpu, nPc);
+		nSh2DrcSkipped++;
+	} else if (nExit == SH2_DRC_EXIT_HANDLER) {
+		nSh2DrcSkipped++;			// the block wrote over its own code and stopped early
+	} else {
+		nSh2DrcChecked++;
+
+		for (INT32 i = 0; i < 16; i++) {
+			if (sh2->r[i] != Ref.r[i]) Sh2DrcMismatch(nPc, _T("rn"), Ref.r[i], sh2->r[i]);
+		}
+		if (sh2->sr != Ref.sr) Sh2DrcMismatch(nPc, _T("sr"), Ref.sr, sh2->sr);
+		if (sh2->pc != Ref.pc) Sh2DrcMismatch(nPc, _T("pc"), Ref.pc, sh2->pc);
+		if (sh2->pr != Ref.pr) Sh2DrcMismatch(nPc, _T("pr"), Ref.pr, sh2->pr);
+		if (sh2->gbr != Ref.gbr) Sh2DrcMismatch(nPc, _T("gbr"), Ref.gbr, sh2->gbr);
+		if (sh2->vbr != Ref.vbr) Sh2DrcMismatch(nPc, _T("vbr"), Ref.vbr, sh2->vbr);
+		if (sh2->mach != Ref.mach) Sh2DrcMismatch(nPc, _T("mach"), Ref.mach, sh2->mach);
+		if (sh2->macl != Ref.macl) Sh2DrcMismatch(nPc, _T("macl"), Ref.macl, sh2->macl);
+		if (sh2->delay != Ref.delay) Sh2DrcMismatch(nPc, _T("delay"), Ref.delay, sh2->delay);
+		if (sh2->sh2_icount != Ref.sh2_icount) Sh2DrcMismatch(nPc, _T("icount"), Ref.sh2_icount, sh2->sh2_icount);
+		if (sh2->sh2_total_cycles != Ref.sh2_total_cycles) Sh2DrcMismatch(nPc, _T("total cycles"), Ref.sh2_total_cycles, sh2->sh2_total_cycles);
+		if (pSh2Ext->suspend != nRefSuspend) Sh2DrcMismatch(nPc, _T("suspend"), nRefSuspend, pSh2Ext->suspend);
+
+		for (INT32 i = 0; i < nSh2JournalCount; i++) {
+			UINT32 nData = Sh2JournalRead(Sh2Journal[i].pMem, Sh2Journal[i].nSize);
+			if (nData != Sh2Journal[i].nNew) Sh2DrcMismatch(nPc, _T("a ram write"), Sh2Journal[i].nNew, nData);
+		}
+	}
+
+	memcpy(sh2, &Ref, sizeof(SH2));
+	pSh2Ext->suspend = nRefSuspend;
+	for (INT32 i = 0; i < nSh2JournalCount; i++) {
+		Sh2JournalStore(Sh2Journal[i].pMem, Sh2Journal[i].nSize, Sh2Journal[i].nNew);
+	}
+
+	change_pc(sh2->pc);
+	Sh2CheckIrq();
+
+	return 1;
+}
+
+// runs a compiled block at the pc, returns 0 if there's none that fits in the cycles left
+static INT32 Sh2DrcRun()
+{
+	Sh2DrcBlock* pBlock = Sh2DrcGetBlock(pSh2Ext - Sh2Ext, pSh2Ext, sh2->pc);
+	if (pBlock->pCode == NULL || pBlock->nCycles >= Sh2DrcBudget()) {
+		return 0;
+	}
+
+	if (sh2_drc_mode == SH2_DRC_LOCKSTEP) {
+		return Sh2DrcLockstep(pBlock);
+	}
+
+	if (pBlock->pCode(pSh2Ext) == SH2_DRC_EXIT_MODIFIED) {
+		Sh2DrcInvalidate(pSh2Ext - Sh2Ext, sh2->pc);
+		return 0;
+	}
+
+	change_pc(sh2->pc);
+	Sh2CheckIrq();
+
+	return 1;
+}
+
+#endif
+
 int Sh2Run(int cycles)
 {
 #if defined FBA_DEBUG
@@ -3270,69 +3511,24 @@ int Sh2Run(int cycles)
 			break;
 		}
 
-		if (pSh2Ext->suspend == 0) {
-			UINT16 opcode;
-
-			if (sh2->delay) {
-				opcode = cpu_readop16(sh2->delay & AM);
-				change_pc(sh2->pc & AM);
-				sh2->delay = 0;
-			} else {
-				opcode = cpu_readop16(sh2->pc & AM);
-				sh2->pc += 2;
-			}
-
-			sh2->ppc = sh2->pc;
-
-			switch (opcode & ( 15 << 12))
-			{
-				case  0<<12: op0000(opcode); break;
-				case  1<<12: op0001(opcode); break;
-				case  2<<12: op0010(opcode); break;
-				case  3<<12: op0011(opcode); break;
-				case  4<<12: op0100(opcode); break;
-				case  5<<12: op0101(opcode); break;
-				case  6<<12: op0110(opcode); break;
-				case  7<<12: op0111(opcode); break;
-				case  8<<12: op1000(opcode); break;
-				case  9<<12: op1001(opcode); break;
-				case 10<<12: op1010(opcode); break;
-				case 11<<12: op1011(opcode); break;
-				case 12<<12: op1100(opcode); break;
-				case 13<<12: op1101(opcode); break;
-				case 14<<12: op1110(opcode); break;
-			default: op1111(opcode); break;
-			}
+#ifdef SH2_X64_DRC
+		if (sh2_drc_mode != SH2_DRC_OFF && pSh2Ext->suspend == 0 && sh2->delay == 0 && sh2->test_irq == 0 && Sh2DrcRun()) {
+			Sh2CheckTimers();
+			continue;
 		}
+#endif
 
-		if(sh2->test_irq && !sh2->delay)
-		{
-			CHECK_PENDING_IRQ(/*"mame_sh2_execute"*/);
-			sh2->test_irq = 0;
+		if (pSh2Ext->suspend == 0) {
+			Sh2Step();
 		}
 
+		Sh2CheckIrq();
+
 		sh2->sh2_total_cycles++;
 		sh2->sh2_icount -= sh2->sh2_eat_cycles;
 		
 		// timer check 
-		
-		{
-			unsigned int cy = sh2_GetTotalCycles();
-
-
-			if (sh2->dma_timer_active[0])
-				if ((cy - sh2->dma_timer_base[0]) >= sh2->dma_timer_cycles[0])
-					sh2_dmac_callback(0);
-
-			if (sh2->dma_timer_active[1])
-				if ((cy - sh2->dma_timer_base[1]) >= sh2->dma_timer_cycles[1])
-					sh2_dmac_callback(1);
-	
-			if ( sh2->timer_active )
-				if ((cy - sh2->timer_base) >= sh2->timer_cycles)
-					sh2_timer_callback();
-		}
-		
+		Sh2CheckTimers();
 		
 	} while( sh2->sh2_icount > 0 );
 	
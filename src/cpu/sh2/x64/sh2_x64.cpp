@@ -0,0 +1,1024 @@
+// SH-2 x64 block recompiler
+//
+// A block is a straight run of instructions that ends at a branch (its delay slot included), before an
+// instruction that is left to the interpreter, at a 64k page boundary or after DRC_BLOCK_MAX instructions.
+// The cpu state stays in SH2EXT (rbx) between instructions, so compiled code and the interpreter can take
+// turns at any block boundary. Sh2Run() only enters a block when it can finish before sh2_icount runs out
+// and before a timer or dma event is due, those are checked between blocks.
+//
+// Memory accesses go straight to the MemMap pages. An access that finds a handler stores the pc and the
+// cycles first, calls the handler like RB() / WB() etc. do and ends the block once the instruction is
+// done, as the handler may have raised an irq, stopped the cpu or remapped memory. A write that lands on
+// the block's own code ends it the same way, the rest of the block is checked again when it's next run.
+// sh2->ea and sh2->ppc aren't kept up to date: only the busy loop hacks read them, and those are always
+// interpreted.
+
+#include "burnint.h"
+#include "sh2_intf.h"
+#include "../sh2_internal.h"
+#include "sh2_x64.h"
+#include "../../mips3/x64/xbyak/xbyak.h"
+#include <stddef.h>
+#include <list>
+#include <functional>
+
+#define DRC_CODE_SIZE		(8 * 1024 * 1024)
+#define DRC_CODE_MARGIN		(128 * 1024)		// left free before a block is compiled, more than any block needs
+#define DRC_BLOCK_MAX		64					// instructions in a block
+#define DRC_BLOCKS			65536				// blocks compiled before the cache is flushed
+
+// instruction types
+#define DRC_INTERPRET		0					// left to the interpreter, the block ends before it
+#define DRC_PLAIN			1
+#define DRC_PCREL			2					// reads the pc, can't go in a delay slot
+#define DRC_DELAYED			3					// delayed branch, compiled together with its delay slot
+#define DRC_BRANCH			4					// BT / BF, ends the block
+
+#if defined _WIN64
+ #define ARG1				ecx
+ #define ARG1q				rcx
+ #define ARG2				edx
+ #define ARG2w				dx
+ #define ARG2b				dl
+#else
+ #define ARG1				edi
+ #define ARG1q				rdi
+ #define ARG2				esi
+ #define ARG2w				si
+ #define ARG2b				sil
+#endif
+
+// the SH2 state is the first member of SH2EXT
+#define STATE_OFF(f)		((UINT32)offsetof(SH2, f))
+#define R_OFF(n)			((UINT32)(offsetof(SH2, r) + (n) * 4))
+#define STATE(f)			dword[rbx + STATE_OFF(f)]
+#define R_x(n)				dword[rbx + R_OFF(n)]
+#define SR_x				STATE(sr)
+#define ICOUNT_x			STATE(sh2_icount)
+#define TOTAL_x				STATE(sh2_total_cycles)
+
+static inline UINT16 DrcFetch(UINT8* pFetch, UINT32 nAddress)
+{
+	return *((UINT16*)(pFetch + ((nAddress ^ 2) & SH2_PAGEM)));
+}
+
+// Returns the DRC_* type of an instruction, with its extra cycles (on top of sh2_eat_cycles) and the
+// extra cycles of a conditional branch when it's taken. next is the instruction after it, for the busy
+// loop hacks.
+static INT32 DrcClassify(UINT16 op, UINT16 next, INT32* pnExtra, INT32* pnTakenExtra)
+{
+	*pnExtra = 0;
+	*pnTakenExtra = 0;
+
+	switch (op >> 12)
+	{
+		case 0x0:
+			switch (op & 0x3f)
+			{
+				case 0x03: case 0x0b: case 0x23:						// BSRF, RTS, BRAF
+					*pnExtra = 1;
+					return DRC_DELAYED;
+
+				case 0x07: case 0x17: case 0x27: case 0x37:				// MUL.L
+					*pnExtra = 1;
+					return DRC_PLAIN;
+
+				case 0x0f: case 0x1f: case 0x2f: case 0x3f:				// MAC.L
+				case 0x1b: case 0x2b:									// SLEEP, RTE
+					return DRC_INTERPRET;
+			}
+			return DRC_PLAIN;
+
+		case 0x3:
+			if ((op & 7) == 5) {										// DMULU.L, DMULS.L
+				*pnExtra = 1;
+			}
+			return DRC_PLAIN;
+
+		case 0x4:
+			switch (op & 0x3f)
+			{
+				case 0x03: case 0x13: case 0x23:						// STC.L
+					*pnExtra = 1;
+					return DRC_PLAIN;
+
+				case 0x17: case 0x27:									// LDC.L @Rm+,GBR / VBR
+					*pnExtra = 2;
+					return DRC_PLAIN;
+
+				case 0x0b:												// JSR
+					*pnExtra = 1;
+					return DRC_DELAYED;
+
+				case 0x2b:												// JMP
+					return DRC_DELAYED;
+
+				case 0x10:												// DT, but not the DT / BF $-2 busy loop
+					return (next == 0x8bfd) ? DRC_INTERPRET : DRC_PLAIN;
+
+				case 0x07: case 0x0e:									// LDC.L @Rm+,SR / LDC Rm,SR
+				case 0x1b:												// TAS.B
+				case 0x0f: case 0x1f: case 0x2f: case 0x3f:				// MAC.W
+					return DRC_INTERPRET;
+			}
+			return DRC_PLAIN;
+
+		case 0x8:
+			switch ((op >> 8) & 15)
+			{
+				case 0x9: case 0xb:										// BT, BF
+					*pnTakenExtra = 2;
+					return DRC_BRANCH;
+
+				case 0xd: case 0xf:										// BT/S, BF/S
+					*pnTakenExtra = 1;
+					return DRC_DELAYED;
+			}
+			return DRC_PLAIN;
+
+		case 0x9:														// MOV.W @(disp,PC),Rn
+		case 0xd:														// MOV.L @(disp,PC),Rn
+			return DRC_PCREL;
+
+		case 0xa:														// BRA, but not the BRA $ busy loop
+			if ((op & 0xfff) == 0xffe) {
+				return DRC_INTERPRET;
+			}
+			*pnExtra = 1;
+			return DRC_DELAYED;
+
+		case 0xb:														// BSR
+			*pnExtra = 1;
+			return DRC_DELAYED;
+
+		case 0xc:
+			switch ((op >> 8) & 15)
+			{
+				case 0x3:												// TRAPA
+				case 0xc: case 0xd: case 0xe: case 0xf:					// TST.B, AND.B, XOR.B, OR.B #imm,@(R0,GBR)
+					return DRC_INTERPRET;
+
+				case 0x7:												// MOVA
+					return DRC_PCREL;
+			}
+			return DRC_PLAIN;
+	}
+
+	return DRC_PLAIN;
+}
+
+class Sh2Drc : public Xbyak::CodeGenerator
+{
+public:
+	Sh2Drc() : CodeGenerator(DRC_CODE_SIZE) { }
+
+	void* Compile(SH2EXT* pExt, UINT32 nPc, INT32* pnCycles, INT32* pnCount);
+
+private:
+	// the out of line part of an access that goes through a handler
+	struct SlowPath {
+		Xbyak::Label lEntry;
+		Xbyak::Label lOverwrite;		// a write hit the block's code
+		INT32 nSize;
+		bool bWrite;
+		bool bSlot;
+		UINT32 nPc;
+		INT32 nCycles;
+		INT32 nCount;
+		INT32 nCost;
+		std::function<void()> Finish;
+	};
+
+	UINT32 m_nPc;				// address of the instruction being compiled
+	bool m_bSlot;				// it's in a delay slot, the branch stored the pc already
+	bool m_bPcStored;			// a branch stored the pc the block ends with
+	INT32 m_nCycles;			// static cycles of the instructions before it
+	INT32 m_nCount;				// instructions before it
+	INT32 m_nCost;				// its own static cycles, sh2_eat_cycles included
+	UINT8* m_pCode;				// host bytes the block was compiled from
+	UINT32 m_nCodeSize;
+	Xbyak::Label* m_plExit;
+	std::list<SlowPath> m_SlowPaths;
+
+	void Emit(UINT16 op);
+	void EmitSlowPath(SlowPath& s);
+	void Access(INT32 nSize, bool bWrite, std::function<void()> Finish);
+	void Load(INT32 nSize, UINT32 nDest, INT32 nInc = -1, INT32 nStep = 0);
+	void Store(INT32 nSize);
+	void Move(UINT32 nDest, UINT32 nSrc);
+	void StoreT();
+	void CondBranch(bool bTrue, bool bDelayed, INT32 nDisp);
+	void Interpret(UINT16 op);
+};
+
+// The address is in ARG1 and the data of a write in ARG2; a read leaves the data in eax, sign extended.
+// Finish() completes the instruction, it runs on the fast path and again on the slow path.
+void Sh2Drc::Access(INT32 nSize, bool bWrite, std::function<void()> Finish)
+{
+	m_SlowPaths.push_back(SlowPath());
+	SlowPath& s = m_SlowPaths.back();
+	s.nSize = nSize;
+	s.bWrite = bWrite;
+	s.bSlot = m_bSlot;
+	s.nPc = m_nPc;
+	s.nCycles = m_nCycles;
+	s.nCount = m_nCount;
+	s.nCost = m_nCost;
+	s.Finish = Finish;
+
+	mov(eax, ARG1);
+	shr(eax, SH2_SHIFT);
+	mov(rax, qword[rbx + rax * 8 + (UINT32)(offsetof(SH2EXT, MemMap) + (bWrite ? SH2_WADD * sizeof(UINT8*) : 0))]);
+	cmp(rax, SH2_MAXHANDLER);
+	jb(s.lEntry, T_NEAR);
+
+	mov(r8d, ARG1);
+	if (nSize == 1) xor_(r8d, 3);
+	if (nSize == 2) xor_(r8d, 2);
+	and_(r8d, SH2_PAGEM);
+
+	if (bWrite) {
+		switch (nSize) {
+			case 1: mov(byte[rax + r8], ARG2b); break;
+			case 2: mov(word[rax + r8], ARG2w); break;
+			case 4: mov(dword[rax + r8], ARG2); break;
+		}
+
+		// a delay slot ends the block anyway
+		if (!m_bSlot) {
+			lea(rcx, ptr[rax + r8]);
+			mov(rdx, (size_t)(m_pCode - (nSize - 1)));
+			sub(rcx, rdx);
+			cmp(rcx, m_nCodeSize + (nSize - 1));
+			jb(s.lOverwrite, T_NEAR);
+		}
+	} else {
+		switch (nSize) {
+			case 1: movsx(eax, byte[rax + r8]); break;
+			case 2: movsx(eax, word[rax + r8]); break;
+			case 4: mov(eax, dword[rax + r8]); break;
+		}
+	}
+
+	Finish();
+}
+
+// rax holds the handler number
+void Sh2Drc::EmitSlowPath(SlowPath& s)
+{
+	UINT32 nHandlers;
+	if (s.bWrite) {
+		nHandlers = (s.nSize == 1) ? offsetof(SH2EXT, WriteByte) : (s.nSize == 2) ? offsetof(SH2EXT, WriteWord) : offsetof(SH2EXT, WriteLong);
+	} else {
+		nHandlers = (s.nSize == 1) ? offsetof(SH2EXT, ReadByte) : (s.nSize == 2) ? offsetof(SH2EXT, ReadWord) : offsetof(SH2EXT, ReadLong);
+	}
+
+	L(s.lEntry);
+
+	// the handler sees the state as the interpreter would leave it
+	if (!s.bSlot) mov(STATE(pc), s.nPc + 2);
+	if (s.nCycles) sub(ICOUNT_x, s.nCycles);
+	if (s.nCount) add(TOTAL_x, s.nCount);
+
+	mov(rax, qword[rbx + rax * 8 + nHandlers]);
+	if (s.bWrite && s.nSize == 1) movzx(ARG2, ARG2b);
+	if (s.bWrite && s.nSize == 2) movzx(ARG2, ARG2w);
+	call(rax);
+	if (!s.bWrite && s.nSize == 1) movsx(eax, al);
+	if (!s.bWrite && s.nSize == 2) movsx(eax, ax);
+
+	s.Finish();
+
+	if (s.nCost) sub(ICOUNT_x, s.nCost);
+	add(TOTAL_x, 1);
+	mov(eax, SH2_DRC_EXIT_HANDLER);
+	jmp(*m_plExit, T_NEAR);
+
+	if (s.bWrite && !s.bSlot) {
+		L(s.lOverwrite);
+		mov(STATE(pc), s.nPc + 2);
+		if (s.nCycles + s.nCost) sub(ICOUNT_x, s.nCycles + s.nCost);
+		add(TOTAL_x, s.nCount + 1);
+		mov(eax, SH2_DRC_EXIT_HANDLER);
+		jmp(*m_plExit, T_NEAR);
+	}
+}
+
+// loads into the state at nDest, then adds nStep to Rn nInc (postincrement)
+void Sh2Drc::Load(INT32 nSize, UINT32 nDest, INT32 nInc, INT32 nStep)
+{
+	Access(nSize, false, [=]() {
+		mov(dword[rbx + nDest], eax);
+		if (nInc >= 0) add(R_x(nInc), nStep);
+	});
+}
+
+void Sh2Drc::Store(INT32 nSize)
+{
+	Access(nSize, true, []() { });
+}
+
+void Sh2Drc::Move(UINT32 nDest, UINT32 nSrc)
+{
+	mov(eax, dword[rbx + nSrc]);
+	mov(dword[rbx + nDest], eax);
+}
+
+// T = cl, as left by a setcc
+void Sh2Drc::StoreT()
+{
+	movzx(ecx, cl);
+	and_(SR_x, ~1u);
+	or_(SR_x, ecx);
+}
+
+// BT / BF, and BT/S / BF/S with bDelayed. The pc is stored both ways, a taken branch costs 2 (1 with a
+// delay slot) extra cycles.
+void Sh2Drc::CondBranch(bool bTrue, bool bDelayed, INT32 nDisp)
+{
+	mov(eax, m_nPc + (bDelayed ? 4 : 2));
+	mov(ecx, (m_nPc + 4 + nDisp * 2) & SH2_AM);
+	test(SR_x, 1);
+	if (bTrue) {
+		cmovnz(eax, ecx);
+		setnz(dl);
+	} else {
+		cmovz(eax, ecx);
+		setz(dl);
+	}
+	movzx(edx, dl);
+	if (!bDelayed) add(edx, edx);
+	sub(ICOUNT_x, edx);
+	mov(STATE(pc), eax);
+
+	m_bPcStored = true;
+}
+
+// instructions that only work on registers and sr, but aren't worth compiling
+void Sh2Drc::Interpret(UINT16 op)
+{
+	mov(ARG1, op);
+	mov(rax, (size_t)Sh2DrcInterpret);
+	call(rax);
+}
+
+void Sh2Drc::Emit(UINT16 op)
+{
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+	UINT32 imm = op & 0xff;
+	UINT32 simm = (UINT32)(INT32)(INT8)imm;
+	UINT32 disp4 = op & 0x0f;
+
+	switch (op >> 12)
+	{
+		case 0x0:
+			switch (op & 0x3f)
+			{
+				case 0x02: Move(R_OFF(n), STATE_OFF(sr)); break;					// STC SR,Rn
+				case 0x12: Move(R_OFF(n), STATE_OFF(gbr)); break;					// STC GBR,Rn
+				case 0x22: Move(R_OFF(n), STATE_OFF(vbr)); break;					// STC VBR,Rn
+				case 0x0a: Move(R_OFF(n), STATE_OFF(mach)); break;					// STS MACH,Rn
+				case 0x1a: Move(R_OFF(n), STATE_OFF(macl)); break;					// STS MACL,Rn
+				case 0x2a: Move(R_OFF(n), STATE_OFF(pr)); break;					// STS PR,Rn
+
+				case 0x03:															// BSRF Rn
+				case 0x23:															// BRAF Rn
+					mov(eax, R_x(n));
+					add(eax, m_nPc + 4);
+					and_(eax, SH2_AM);
+					if ((op & 0x3f) == 0x03) mov(STATE(pr), m_nPc + 4);
+					mov(STATE(pc), eax);
+					m_bPcStored = true;
+					break;
+
+				case 0x0b:															// RTS
+					mov(eax, STATE(pr));
+					and_(eax, SH2_AM);
+					mov(STATE(pc), eax);
+					m_bPcStored = true;
+					break;
+
+				case 0x04: case 0x14: case 0x24: case 0x34:							// MOV.B Rm,@(R0,Rn)
+				case 0x05: case 0x15: case 0x25: case 0x35:							// MOV.W Rm,@(R0,Rn)
+				case 0x06: case 0x16: case 0x26: case 0x36:							// MOV.L Rm,@(R0,Rn)
+					mov(ARG1, R_x(n));
+					add(ARG1, R_x(0));
+					mov(ARG2, R_x(m));
+					Store(((op & 3) == 0) ? 1 : ((op & 3) == 1) ? 2 : 4);
+					break;
+
+				case 0x0c: case 0x1c: case 0x2c: case 0x3c:							// MOV.B @(R0,Rm),Rn
+				case 0x0d: case 0x1d: case 0x2d: case 0x3d:							// MOV.W @(R0,Rm),Rn
+				case 0x0e: case 0x1e: case 0x2e: case 0x3e:							// MOV.L @(R0,Rm),Rn
+					mov(ARG1, R_x(m));
+					add(ARG1, R_x(0));
+					Load(((op & 3) == 0) ? 1 : ((op & 3) == 1) ? 2 : 4, R_OFF(n));
+					break;
+
+				case 0x07: case 0x17: case 0x27: case 0x37:							// MUL.L Rm,Rn
+					mov(eax, R_x(n));
+					imul(eax, R_x(m));
+					mov(STATE(macl), eax);
+					break;
+
+				case 0x08: and_(SR_x, ~1u); break;									// CLRT
+				case 0x18: or_(SR_x, 1); break;										// SETT
+				case 0x19: and_(SR_x, ~0x301u); break;								// DIV0U
+
+				case 0x28:															// CLRMAC
+					mov(STATE(mach), 0);
+					mov(STATE(macl), 0);
+					break;
+
+				case 0x29:															// MOVT Rn
+					mov(eax, SR_x);
+					and_(eax, 1);
+					mov(R_x(n), eax);
+					break;
+			}
+			break;
+
+		case 0x1:																	// MOV.L Rm,@(disp,Rn)
+			mov(ARG1, R_x(n));
+			if (disp4) add(ARG1, disp4 * 4);
+			mov(ARG2, R_x(m));
+			Store(4);
+			break;
+
+		case 0x2:
+			switch (op & 15)
+			{
+				case 0x0: case 0x1: case 0x2:										// MOV.x Rm,@Rn
+					mov(ARG2, R_x(m));
+					mov(ARG1, R_x(n));
+					Store(1 << (op & 3));
+					break;
+
+				case 0x4: case 0x5: case 0x6:										// MOV.x Rm,@-Rn
+					mov(ARG2, R_x(m));
+					sub(R_x(n), 1 << (op & 3));
+					mov(ARG1, R_x(n));
+					Store(1 << (op & 3));
+					break;
+
+				case 0x7: Interpret(op); break;										// DIV0S Rm,Rn
+
+				case 0x8:															// TST Rm,Rn
+					mov(eax, R_x(n));
+					test(R_x(m), eax);
+					sete(cl);
+					StoreT();
+					break;
+
+				case 0x9: mov(eax, R_x(m)); and_(R_x(n), eax); break;				// AND Rm,Rn
+				case 0xa: mov(eax, R_x(m)); xor_(R_x(n), eax); break;				// XOR Rm,Rn
+				case 0xb: mov(eax, R_x(m)); or_(R_x(n), eax); break;				// OR Rm,Rn
+
+				case 0xc: Interpret(op); break;										// CMP/STR Rm,Rn
+
+				case 0xd:															// XTRCT Rm,Rn
+					mov(eax, R_x(n));
+					shr(eax, 16);
+					mov(ecx, R_x(m));
+					shl(ecx, 16);
+					or_(eax, ecx);
+					mov(R_x(n), eax);
+					break;
+
+				case 0xe:															// MULU.W Rm,Rn
+				case 0xf:															// MULS.W Rm,Rn
+					if (op & 1) {
+						movsx(eax, word[rbx + R_OFF(n)]);
+						movsx(ecx, word[rbx + R_OFF(m)]);
+					} else {
+						movzx(eax, word[rbx + R_OFF(n)]);
+						movzx(ecx, word[rbx + R_OFF(m)]);
+					}
+					imul(eax, ecx);
+					mov(STATE(macl), eax);
+					break;
+			}
+			break;
+
+		case 0x3:
+			switch (op & 15)
+			{
+				case 0x0: case 0x2: case 0x3: case 0x6: case 0x7:					// CMP/EQ, CMP/HS, CMP/GE, CMP/HI, CMP/GT Rm,Rn
+					mov(eax, R_x(n));
+					cmp(eax, R_x(m));
+					switch (op & 15) {
+						case 0x0: sete(cl); break;
+						case 0x2: setae(cl); break;
+						case 0x3: setge(cl); break;
+						case 0x6: seta(cl); break;
+						case 0x7: setg(cl); break;
+					}
+					StoreT();
+					break;
+
+				case 0x4: case 0xb: case 0xf: Interpret(op); break;					// DIV1, SUBV, ADDV Rm,Rn
+
+				case 0x5:															// DMULU.L Rm,Rn
+				case 0xd:															// DMULS.L Rm,Rn
+					if (op & 8) {
+						movsxd(rax, R_x(n));
+						movsxd(rcx, R_x(m));
+					} else {
+						mov(eax, R_x(n));
+						mov(ecx, R_x(m));
+					}
+					imul(rax, rcx);
+					mov(STATE(macl), eax);
+					shr(rax, 32);
+					mov(STATE(mach), eax);
+					break;
+
+				case 0x8: mov(eax, R_x(m)); sub(R_x(n), eax); break;				// SUB Rm,Rn
+				case 0xc: mov(eax, R_x(m)); add(R_x(n), eax); break;				// ADD Rm,Rn
+
+				case 0xa:															// SUBC Rm,Rn
+				case 0xe:															// ADDC Rm,Rn
+					mov(eax, SR_x);
+					shr(eax, 1);													// carry = T
+					mov(eax, R_x(n));
+					if (op & 4) {
+						adc(eax, R_x(m));
+					} else {
+						sbb(eax, R_x(m));
+					}
+					mov(R_x(n), eax);
+					setc(cl);
+					StoreT();
+					break;
+			}
+			break;
+
+		case 0x4:
+			switch (op & 0x3f)
+			{
+				case 0x00: case 0x20: shl(R_x(n), 1); setc(cl); StoreT(); break;	// SHLL, SHAL Rn
+				case 0x01: shr(R_x(n), 1); setc(cl); StoreT(); break;				// SHLR Rn
+				case 0x21: sar(R_x(n), 1); setc(cl); StoreT(); break;				// SHAR Rn
+				case 0x04: rol(R_x(n), 1); setc(cl); StoreT(); break;				// ROTL Rn
+				case 0x05: ror(R_x(n), 1); setc(cl); StoreT(); break;				// ROTR Rn
+
+				case 0x24:															// ROTCL Rn
+				case 0x25:															// ROTCR Rn
+					mov(eax, SR_x);
+					shr(eax, 1);
+					if (op & 1) {
+						rcr(R_x(n), 1);
+					} else {
+						rcl(R_x(n), 1);
+					}
+					setc(cl);
+					StoreT();
+					break;
+
+				case 0x08: shl(R_x(n), 2); break;									// SHLL2 Rn
+				case 0x18: shl(R_x(n), 8); break;									// SHLL8 Rn
+				case 0x28: shl(R_x(n), 16); break;									// SHLL16 Rn
+				case 0x09: shr(R_x(n), 2); break;									// SHLR2 Rn
+				case 0x19: shr(R_x(n), 8); break;									// SHLR8 Rn
+				case 0x29: shr(R_x(n), 16); break;									// SHLR16 Rn
+
+				case 0x10: sub(R_x(n), 1); sete(cl); StoreT(); break;				// DT Rn
+
+				case 0x11:															// CMP/PZ Rn
+				case 0x15:															// CMP/PL Rn
+					cmp(R_x(n), 0);
+					if (op & 4) {
+						setg(cl);
+					} else {
+						setge(cl);
+					}
+					StoreT();
+					break;
+
+				case 0x02: case 0x12: case 0x22:									// STS.L MACH / MACL / PR,@-Rn
+				case 0x03: case 0x13: case 0x23:									// STC.L SR / GBR / VBR,@-Rn
+				{
+					static const UINT32 nSrc[6] = { STATE_OFF(mach), STATE_OFF(sr), STATE_OFF(macl), STATE_OFF(gbr), STATE_OFF(pr), STATE_OFF(vbr) };
+					sub(R_x(n), 4);
+					mov(ARG1, R_x(n));
+					mov(ARG2, dword[rbx + nSrc[((op >> 3) & 6) | (op & 1)]]);
+					Store(4);
+					break;
+				}
+
+				case 0x06: case 0x16: case 0x26:									// LDS.L @Rm+,MACH / MACL / PR
+				case 0x17: case 0x27:												// LDC.L @Rm+,GBR / VBR
+				{
+					static const UINT32 nDest[6] = { STATE_OFF(mach), 0, STATE_OFF(macl), STATE_OFF(gbr), STATE_OFF(pr), STATE_OFF(vbr) };
+					mov(ARG1, R_x(n));
+					Load(4, nDest[((op >> 3) & 6) | (op & 1)], n, 4);
+					break;
+				}
+
+				case 0x0a: Move(STATE_OFF(mach), R_OFF(n)); break;					// LDS Rm,MACH
+				case 0x1a: Move(STATE_OFF(macl), R_OFF(n)); break;					// LDS Rm,MACL
+				case 0x2a: Move(STATE_OFF(pr), R_OFF(n)); break;					// LDS Rm,PR
+				case 0x1e: Move(STATE_OFF(gbr), R_OFF(n)); break;					// LDC Rm,GBR
+				case 0x2e: Move(STATE_OFF(vbr), R_OFF(n)); break;					// LDC Rm,VBR
+
+				case 0x0b:															// JSR @Rm
+				case 0x2b:															// JMP @Rm
+					mov(eax, R_x(n));
+					and_(eax, SH2_AM);
+					if ((op & 0x3f) == 0x0b) mov(STATE(pr), m_nPc + 4);
+					mov(STATE(pc), eax);
+					m_bPcStored = true;
+					break;
+			}
+			break;
+
+		case 0x5:																	// MOV.L @(disp,Rm),Rn
+			mov(ARG1, R_x(m));
+			if (disp4) add(ARG1, disp4 * 4);
+			Load(4, R_OFF(n));
+			break;
+
+		case 0x6:
+			switch (op & 15)
+			{
+				case 0x0: case 0x1: case 0x2:										// MOV.x @Rm,Rn
+					mov(ARG1, R_x(m));
+					Load(1 << (op & 3), R_OFF(n));
+					break;
+
+				case 0x4: case 0x5: case 0x6:										// MOV.x @Rm+,Rn
+					mov(ARG1, R_x(m));
+					Load(1 << (op & 3), R_OFF(n), (n != m) ? m : -1, 1 << (op & 3));
+					break;
+
+				case 0x3: Move(R_OFF(n), R_OFF(m)); break;							// MOV Rm,Rn
+				case 0x7: mov(eax, R_x(m)); not_(eax); mov(R_x(n), eax); break;		// NOT Rm,Rn
+				case 0x8: mov(eax, R_x(m)); rol(ax, 8); mov(R_x(n), eax); break;	// SWAP.B Rm,Rn
+				case 0x9: mov(eax, R_x(m)); rol(eax, 16); mov(R_x(n), eax); break;	// SWAP.W Rm,Rn
+				case 0xa: Interpret(op); break;										// NEGC Rm,Rn
+				case 0xb: mov(eax, R_x(m)); neg(eax); mov(R_x(n), eax); break;		// NEG Rm,Rn
+				case 0xc: movzx(eax, byte[rbx + R_OFF(m)]); mov(R_x(n), eax); break;	// EXTU.B Rm,Rn
+				case 0xd: movzx(eax, word[rbx + R_OFF(m)]); mov(R_x(n), eax); break;	// EXTU.W Rm,Rn
+				case 0xe: movsx(eax, byte[rbx + R_OFF(m)]); mov(R_x(n), eax); break;	// EXTS.B Rm,Rn
+				case 0xf: movsx(eax, word[rbx + R_OFF(m)]); mov(R_x(n), eax); break;	// EXTS.W Rm,Rn
+			}
+			break;
+
+		case 0x7:																	// ADD #imm,Rn
+			add(R_x(n), simm);
+			break;
+
+		case 0x8:
+			switch (n)
+			{
+				case 0x0: case 0x1:													// MOV.B / MOV.W R0,@(disp,Rm)
+					mov(ARG1, R_x(m));
+					if (disp4) add(ARG1, disp4 << n);
+					mov(ARG2, R_x(0));
+					Store(1 << n);
+					break;
+
+				case 0x4: case 0x5:													// MOV.B / MOV.W @(disp,Rm),R0
+					mov(ARG1, R_x(m));
+					if (disp4) add(ARG1, disp4 << (n & 1));
+					Load(1 << (n & 1), R_OFF(0));
+					break;
+
+				case 0x8:															// CMP/EQ #imm,R0
+					cmp(R_x(0), simm);
+					sete(cl);
+					StoreT();
+					break;
+
+				case 0x9: CondBranch(true, false, (INT8)imm); break;				// BT
+				case 0xb: CondBranch(false, false, (INT8)imm); break;				// BF
+				case 0xd: CondBranch(true, true, (INT8)imm); break;					// BT/S
+				case 0xf: CondBranch(false, true, (INT8)imm); break;				// BF/S
+			}
+			break;
+
+		case 0x9:																	// MOV.W @(disp,PC),Rn
+			mov(ARG1, m_nPc + 4 + imm * 2);
+			Load(2, R_OFF(n));
+			break;
+
+		case 0xa:																	// BRA
+		case 0xb:																	// BSR
+		{
+			INT32 nDisp = ((INT32)(op & 0xfff) << 20) >> 20;
+			if (op & 0x1000) mov(STATE(pr), m_nPc + 4);
+			mov(STATE(pc), (m_nPc + 4 + nDisp * 2) & SH2_AM);
+			m_bPcStored = true;
+			break;
+		}
+
+		case 0xc:
+			switch (n)
+			{
+				case 0x0: case 0x1: case 0x2:										// MOV.x R0,@(disp,GBR)
+					mov(ARG1, STATE(gbr));
+					if (imm) add(ARG1, imm << n);
+					mov(ARG2, R_x(0));
+					Store(1 << n);
+					break;
+
+				case 0x4: case 0x5: case 0x6:										// MOV.x @(disp,GBR),R0
+					mov(ARG1, STATE(gbr));
+					if (imm) add(ARG1, imm << (n & 3));
+					Load(1 << (n & 3), R_OFF(0));
+					break;
+
+				case 0x7:															// MOVA @(disp,PC),R0
+					mov(R_x(0), ((m_nPc + 4) & ~3) + imm * 4);
+					break;
+
+				case 0x8:															// TST #imm,R0
+					test(R_x(0), imm);
+					sete(cl);
+					StoreT();
+					break;
+
+				case 0x9: and_(R_x(0), imm); break;									// AND #imm,R0
+				case 0xa: xor_(R_x(0), imm); break;									// XOR #imm,R0
+				case 0xb: or_(R_x(0), imm); break;									// OR #imm,R0
+			}
+			break;
+
+		case 0xd:																	// MOV.L @(disp,PC),Rn
+			mov(ARG1, ((m_nPc + 4) & ~3) + imm * 4);
+			Load(4, R_OFF(n));
+			break;
+
+		case 0xe:																	// MOV #imm,Rn
+			mov(R_x(n), simm);
+			break;
+	}
+}
+
+void* Sh2Drc::Compile(SH2EXT* pExt, UINT32 nPc, INT32* pnCycles, INT32* pnCount)
+{
+	UINT8* pFetch = pExt->MemMap[(nPc >> SH2_SHIFT) + SH2_WADD * 2];
+	if ((uintptr_t)pFetch < SH2_MAXHANDLER) {
+		return NULL;														// fetched through a handler
+	}
+
+	// find where the block ends
+	UINT16 nOps[DRC_BLOCK_MAX];
+	INT32 nTypes[DRC_BLOCK_MAX];
+	INT32 nCount = 0, nTakenCycles = 0, nExtra, nTakenExtra;
+	UINT32 nEnd = (nPc & ~SH2_PAGEM) + SH2_PAGE_SIZE;
+	UINT32 pc = nPc;
+
+	while (nCount < DRC_BLOCK_MAX && pc < nEnd) {
+		UINT16 op = DrcFetch(pFetch, pc);
+		UINT16 next = (pc + 2 < nEnd) ? DrcFetch(pFetch, pc + 2) : 0x8bfd;
+		INT32 nType = DrcClassify(op, next, &nExtra, &nTakenExtra);
+
+		if (nType == DRC_INTERPRET) {
+			break;
+		}
+
+		if (nType == DRC_DELAYED) {
+			// the delay slot has to be compiled too, DT is left out as its busy loop check reads ppc
+			UINT16 next2 = (pc + 4 < nEnd) ? DrcFetch(pFetch, pc + 4) : 0x8bfd;
+			INT32 nSlotExtra, nSlotTakenExtra;
+			if (nCount + 2 > DRC_BLOCK_MAX || pc + 2 >= nEnd || (next & 0xf03f) == 0x4010 || DrcClassify(next, next2, &nSlotExtra, &nSlotTakenExtra) != DRC_PLAIN) {
+				break;
+			}
+			nTypes[nCount] = nType;
+			nOps[nCount++] = op;
+			nTypes[nCount] = DRC_PLAIN;
+			nOps[nCount++] = next;
+			nTakenCycles += nTakenExtra;
+			break;
+		}
+
+		nTypes[nCount] = nType;
+		nOps[nCount++] = op;
+		nTakenCycles += nTakenExtra;
+		pc += 2;
+
+		if (nType == DRC_BRANCH) {
+			break;
+		}
+	}
+
+	if (nCount == 0) {
+		return NULL;
+	}
+
+	void* pCode = (void*)getCurr();
+	Xbyak::Label lExit, lModified;
+	m_plExit = &lExit;
+	m_pCode = pFetch + (nPc & SH2_PAGEM & ~3);
+	m_nCodeSize = (((nPc + nCount * 2 - 1) & SH2_PAGEM) | 3) + 1 - (nPc & SH2_PAGEM & ~3);
+	m_SlowPaths.clear();
+
+	push(rbx);
+	sub(rsp, 32);															// keeps the stack aligned for calls, and the win64 shadow space
+	mov(rbx, ARG1q);
+
+	// check the code is still what it was compiled from
+	mov(rax, (size_t)pFetch);
+	for (INT32 i = 0; i < nCount; ) {
+		UINT32 nAddress = nPc + i * 2;
+		if ((nAddress & 2) == 0 && i + 1 < nCount) {
+			cmp(dword[rax + (nAddress & SH2_PAGEM)], ((UINT32)nOps[i] << 16) | nOps[i + 1]);
+			i += 2;
+		} else {
+			cmp(word[rax + ((nAddress ^ 2) & SH2_PAGEM)], (UINT32)(INT16)nOps[i]);
+			i++;
+		}
+		jne(lModified, T_NEAR);
+	}
+
+	m_nCycles = 0;
+	m_nCount = 0;
+	m_bSlot = false;
+	m_bPcStored = false;
+
+	for (INT32 i = 0; i < nCount; i++) {
+		DrcClassify(nOps[i], 0, &nExtra, &nTakenExtra);
+		m_nPc = nPc + i * 2;
+		m_nCost = pExt->sh2.sh2_eat_cycles + nExtra;
+
+		Emit(nOps[i]);
+
+		m_nCycles += m_nCost;
+		m_nCount++;
+		m_bSlot = (nTypes[i] == DRC_DELAYED);
+	}
+
+	if (!m_bPcStored) {
+		mov(STATE(pc), nPc + nCount * 2);
+	}
+	sub(ICOUNT_x, m_nCycles);
+	add(TOTAL_x, m_nCount);
+	xor_(eax, eax);
+
+	L(lExit);
+	add(rsp, 32);
+	pop(rbx);
+	ret();
+
+	L(lModified);
+	mov(eax, SH2_DRC_EXIT_MODIFIED);
+	jmp(lExit, T_NEAR);
+
+	for (std::list<SlowPath>::iterator it = m_SlowPaths.begin(); it != m_SlowPaths.end(); it++) {
+		EmitSlowPath(*it);
+	}
+	m_SlowPaths.clear();
+
+	*pnCycles = m_nCycles + nTakenCycles;
+	*pnCount = nCount;
+
+	return pCode;
+}
+
+//----------------------------------------------------------------------------------------------------
+
+static Sh2Drc* pDrc = NULL;
+static INT32 nDrcCpuCount = 0;
+typedef Sh2DrcBlock* DrcPage[SH2_PAGE_SIZE >> 1];	// the blocks of a 64k page, by (pc & 0xffff) >> 1
+
+static DrcPage*** pDrcPages = NULL;			// [cpu][pc >> 16], allocated as they're used
+static INT32* pDrcEatCycles = NULL;			// the sh2_eat_cycles each cpu's blocks were compiled with
+static Sh2DrcBlock* pDrcBlocks = NULL;
+static INT32 nDrcBlocks = 0;
+
+static Sh2DrcBlock DrcInterpretBlock = { NULL, 0, 0 };
+
+static void DrcFlushCpu(INT32 nCpu)
+{
+	for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+		if (pDrcPages[nCpu][i]) {
+			free(pDrcPages[nCpu][i]);
+			pDrcPages[nCpu][i] = NULL;
+		}
+	}
+}
+
+INT32 Sh2DrcInit(INT32 nCount)
+{
+	nDrcCpuCount = nCount;
+	nDrcBlocks = 0;
+
+	pDrcPages = (DrcPage***)malloc(nCount * sizeof(DrcPage**));
+	pDrcEatCycles = (INT32*)malloc(nCount * sizeof(INT32));
+	pDrcBlocks = (Sh2DrcBlock*)malloc(DRC_BLOCKS * sizeof(Sh2DrcBlock));
+	if (pDrcPages == NULL || pDrcEatCycles == NULL || pDrcBlocks == NULL) {
+		return 1;
+	}
+
+	for (INT32 i = 0; i < nCount; i++) {
+		pDrcPages[i] = (DrcPage**)malloc(SH2_PAGE_COUNT * sizeof(DrcPage*));
+		if (pDrcPages[i] == NULL) {
+			return 1;
+		}
+		memset(pDrcPages[i], 0, SH2_PAGE_COUNT * sizeof(DrcPage*));
+		pDrcEatCycles[i] = -1;
+	}
+
+	return 0;
+}
+
+void Sh2DrcExit()
+{
+	if (pDrcPages) {
+		for (INT32 i = 0; i < nDrcCpuCount; i++) {
+			if (pDrcPages[i]) {
+				DrcFlushCpu(i);
+				free(pDrcPages[i]);
+			}
+		}
+		free(pDrcPages);
+		pDrcPages = NULL;
+	}
+	if (pDrcEatCycles) {
+		free(pDrcEatCycles);
+		pDrcEatCycles = NULL;
+	}
+	if (pDrcBlocks) {
+		free(pDrcBlocks);
+		pDrcBlocks = NULL;
+	}
+
+	delete pDrc;
+	pDrc = NULL;
+
+	nDrcCpuCount = 0;
+	nDrcBlocks = 0;
+}
+
+// Throws away every compiled block, when the memory map changes or the cache is full
+void Sh2DrcFlush()
+{
+	if (pDrc == NULL) {
+		return;		// nothing compiled yet
+	}
+
+	for (INT32 i = 0; i < nDrcCpuCount; i++) {
+		DrcFlushCpu(i);
+	}
+
+	nDrcBlocks = 0;
+	pDrc->reset();
+}
+
+Sh2DrcBlock* Sh2DrcGetBlock(INT32 nCpu, SH2EXT* pExt, UINT32 nPc)
+{
+	if ((nPc & 1) || (nPc & ~SH2_AM) || pDrcBlocks == NULL) {
+		return &DrcInterpretBlock;
+	}
+
+	if (pDrcEatCycles[nCpu] != pExt->sh2.sh2_eat_cycles) {
+		DrcFlushCpu(nCpu);
+		pDrcEatCycles[nCpu] = pExt->sh2.sh2_eat_cycles;
+	}
+
+	DrcPage* pPage = pDrcPages[nCpu][nPc >> SH2_SHIFT];
+	if (pPage && (*pPage)[(nPc & SH2_PAGEM) >> 1]) {
+		return (*pPage)[(nPc & SH2_PAGEM) >> 1];
+	}
+
+	if (pDrc == NULL) {
+		pDrc = new Sh2Drc;
+	}
+	if (nDrcBlocks == DRC_BLOCKS || pDrc->getSize() + DRC_CODE_MARGIN > DRC_CODE_SIZE) {
+		Sh2DrcFlush();
+	}
+
+	pPage = pDrcPages[nCpu][nPc >> SH2_SHIFT];
+	if (pPage == NULL) {
+		pPage = (DrcPage*)malloc(sizeof(DrcPage));
+		if (pPage == NULL) {
+			return &DrcInterpretBlock;
+		}
+		memset(pPage, 0, sizeof(DrcPage));
+		pDrcPages[nCpu][nPc >> SH2_SHIFT] = pPage;
+	}
+
+	Sh2DrcBlock* pBlock = &DrcInterpretBlock;
+	INT32 nCycles, nCount;
+	void* pCode = pDrc->Compile(pExt, nPc, &nCycles, &nCount);
+	if (pCode) {
+		pBlock = &pDrcBlocks[nDrcBlocks++];
+		pBlock->pCode = Xbyak::CastTo<INT32 (*)(SH2EXT*)>(pCode);
+		pBlock->nCycles = nCycles;
+		pBlock->nCount = nCount;
+	}
+	(*pPage)[(nPc & SH2_PAGEM) >> 1] = pBlock;
+
+	return pBlock;
+}
+
+// Drops the block at nPc, it's compiled again on its next run
+void Sh2DrcInvalidate(INT32 nCpu, UINT32 nPc)
+{
+	DrcPage* pPage = pDrcPages[nCpu][nPc >> SH2_SHIFT];
+	if (pPage) {
+		(*pPage)[(nPc & SH2_PAGEM) >> 1] = NULL;
+	}
+}
@@ -0,0 +1,22 @@
+// SH-2 x64 block recompiler (see sh2_x64.cpp), used by Sh2Run() when built with SH2_X64_DRC
+
+struct Sh2DrcBlock {
+	INT32 (*pCode)(SH2EXT* pExt);		// NULL: the instruction at this pc is left to the interpreter
+	INT32 nCycles;						// the most cycles (sh2_icount) the block can take
+	INT32 nCount;						// instructions, a delay slot included
+};
+
+// pCode() return values
+#define SH2_DRC_EXIT_END		0		// ran to the end of the block
+#define SH2_DRC_EXIT_HANDLER	1		// stopped after an instruction that went through a memory handler, or wrote over the block
+#define SH2_DRC_EXIT_MODIFIED	2		// the code was overwritten since it was compiled, nothing was run
+
+INT32 Sh2DrcInit(INT32 nCount);
+void Sh2DrcExit();
+void Sh2DrcFlush();
+
+Sh2DrcBlock* Sh2DrcGetBlock(INT32 nCpu, SH2EXT* pExt, UINT32 nPc);
+void Sh2DrcInvalidate(INT32 nCpu, UINT32 nPc);
+
+// in sh2.cpp: runs an instruction that only works on registers and sr through the interpreter
+void Sh2DrcInterpret(UINT32 opcode);
@@ -16,6 +16,12 @@ extern int has_sh2;
 extern INT32 cps3speedhack;
 extern INT32 sh2_busyloop_speedhack_mode2;
 
+// x64 recompiler, in builds with SH2_X64_DRC
+#define SH2_DRC_OFF			0
+#define SH2_DRC_ON			1
+#define SH2_DRC_LOCKSTEP	2		// checks every compiled block against the interpreter
+extern INT32 sh2_drc_mode;
+
 void __fastcall Sh2WriteByte(unsigned int a, unsigned char d);
 unsigned char __fastcall Sh2ReadByte(unsigned int a);
 
@@ -109,13 +109,16 @@ static Z80WriteProgHandler Z80ProgramWrite;
 static Z80ReadOpHandler Z80CPUReadOp;
 static Z80ReadOpArgHandler Z80CPUReadOpArg;
 
+static UINT8* Z80NoMemMap[0x400];			// all pages go through the handlers
+static UINT8** Z80MemMap = Z80NoMemMap;		// see Z80SetMemMap()
+
 #define Z80Vector Z80.vector
 
 #define VERBOSE 0
 
 #define LOG(x)	//do { if (VERBOSE) logerror x; } while (0)
 
-/* execute main opcodes inside a big switch statement */
+/* execute opcodes (main and after a prefix) inside big switch statements */
 #ifndef BIG_SWITCH
 #define BIG_SWITCH			1
 #endif
@@ -545,7 +548,7 @@ Z80_INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 	}																																	\
 }
 #else
-#define EXEC_Z80_INLINE EXEC
+#define EXEC_INLINE EXEC
 #endif
 
 
@@ -582,8 +585,14 @@ Z80_INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 
 /***************************************************************
  * Read a byte from given memory location
+ * Mapped pages are read here, the others through the handler
  ***************************************************************/
-#define RM(addr) (UINT8)Z80ProgramRead(addr)
+Z80_INLINE UINT8 RM(UINT32 addr)
+{
+	UINT8 *p = Z80MemMap[0x000 | (addr >> 8)];
+	if (p) return p[addr & 0xff];
+	return (UINT8)Z80ProgramRead(addr);
+}
 
 /***************************************************************
  * Read a word from given memory location
@@ -597,10 +606,29 @@ Z80_INLINE void RM16( UINT32 addr, Z80_PAIR *r )
 /***************************************************************
  * Write a byte to given memory location
  ***************************************************************/
-#define WM(addr,value) Z80ProgramWrite(addr,value)
+Z80_INLINE void WM(UINT32 addr, UINT8 value)
+{
+	UINT8 *p = Z80MemMap[0x100 | (addr >> 8)];
+	if (p) { p[addr & 0xff] = value; return; }
+	Z80ProgramWrite(addr, value);
+}
 
-#define cpu_readop(n) Z80CPUReadOp(n)
-#define cpu_readop_arg(n) Z80CPUReadOpArg(n)
+/***************************************************************
+ * Read an opcode / opcode argument, from their own pages
+ ***************************************************************/
+Z80_INLINE UINT8 cpu_readop(UINT32 addr)
+{
+	UINT8 *p = Z80MemMap[0x200 | (addr >> 8)];
+	if (p) return p[addr & 0xff];
+	return Z80CPUReadOp(addr);
+}
+
+Z80_INLINE UINT8 cpu_readop_arg(UINT32 addr)
+{
+	UINT8 *p = Z80MemMap[0x300 | (addr >> 8)];
+	if (p) return p[addr & 0xff];
+	return Z80CPUReadOpArg(addr);
+}
 
 /***************************************************************
  * Write a word to given memory location
@@ -2383,7 +2411,7 @@ OP(dd,c7) { illegal_1(); op_c7();								}		  /* DB   DD          */
 OP(dd,c8) { illegal_1(); op_c8();								} /* DB   DD          */
 OP(dd,c9) { illegal_1(); op_c9();								} /* DB   DD          */
 OP(dd,ca) { illegal_1(); op_ca();								} /* DB   DD          */
-OP(dd,cb) { EAX; EXEC(xycb,ARG());							} /* **   DD CB xx    */
+OP(dd,cb) { EAX; EXEC_INLINE(xycb,ARG());					} /* **   DD CB xx    */
 OP(dd,cc) { illegal_1(); op_cc();								} /* DB   DD          */
 OP(dd,cd) { illegal_1(); op_cd();								} /* DB   DD          */
 OP(dd,ce) { illegal_1(); op_ce();								} /* DB   DD          */
@@ -2674,7 +2702,7 @@ OP(fd,c7) { illegal_1(); op_c7();								} /* DB   FD          */
 OP(fd,c8) { illegal_1(); op_c8();								} /* DB   FD          */
 OP(fd,c9) { illegal_1(); op_c9();								} /* DB   FD          */
 OP(fd,ca) { illegal_1(); op_ca();								} /* DB   FD          */
-OP(fd,cb) { EAY; EXEC(xycb,ARG());							} /* **   FD CB xx    */
+OP(fd,cb) { EAY; EXEC_INLINE(xycb,ARG());					} /* **   FD CB xx    */
 OP(fd,cc) { illegal_1(); op_cc();								} /* DB   FD          */
 OP(fd,cd) { illegal_1(); op_cd();								} /* DB   FD          */
 OP(fd,ce) { illegal_1(); op_ce();								} /* DB   FD          */
@@ -3268,7 +3296,7 @@ OP(op,c7) { RST(0x00);											} /* RST  0           */
 OP(op,c8) { RET_COND( F & ZF, 0xc8 );							} /* RET  Z           */
 OP(op,c9) { POP( pc ); change_pc(PCD);WZ = PCD;  				} /* RET              */
 OP(op,ca) { JP_COND( F & ZF );									} /* JP   Z,a         */
-OP(op,cb) { R++; EXEC(cb,ROP());								} /* **** CB xx       */
+OP(op,cb) { R++; EXEC_INLINE(cb,ROP());							} /* **** CB xx       */
 OP(op,cc) { CALL_COND( F & ZF, 0xcc );							} /* CALL Z,a         */
 OP(op,cd) { CALL();												} /* CALL a           */
 OP(op,ce) { ADC(ARG());											} /* ADC  A,n         */
@@ -3288,7 +3316,7 @@ OP(op,d9) { EXX;												} /* EXX              */
 OP(op,da) { JP_COND( F & CF );									} /* JP   C,a         */
 OP(op,db) { unsigned n = ARG() | (A << 8); A = IN( n ); WZ = n + 1;			} /* IN   A,(n)       */
 OP(op,dc) { CALL_COND( F & CF, 0xdc );							} /* CALL C,a         */
-OP(op,dd) { R++; EXEC(dd,ROP());								} /* **** DD xx       */
+OP(op,dd) { R++; EXEC_INLINE(dd,ROP());							} /* **** DD xx       */
 OP(op,de) { SBC(ARG());											} /* SBC  A,n         */
 OP(op,df) { RST(0x18);											} /* RST  3           */
 
@@ -3306,7 +3334,7 @@ OP(op,e9) { PC = HL; change_pc(PCD);							} /* JP   (HL)        */
 OP(op,ea) { JP_COND( F & PF );									} /* JP   PE,a        */
 OP(op,eb) { EX_DE_HL;											} /* EX   DE,HL       */
 OP(op,ec) { CALL_COND( F & PF, 0xec );							} /* CALL PE,a        */
-OP(op,ed) { R++; EXEC(ed,ROP());								} /* **** ED xx       */
+OP(op,ed) { R++; EXEC_INLINE(ed,ROP());							} /* **** ED xx       */
 OP(op,ee) { XOR(ARG());											} /* XOR  n           */
 OP(op,ef) { RST(0x28);											} /* RST  5           */
 
@@ -3324,7 +3352,7 @@ OP(op,f9) { SP = HL;											} /* LD   SP,HL       */
 OP(op,fa) { JP_COND(F & SF);									} /* JP   M,a         */
 OP(op,fb) { EI;													} /* EI               */
 OP(op,fc) { CALL_COND( F & SF, 0xfc );							} /* CALL M,a         */
-OP(op,fd) { R++; EXEC(fd,ROP());								} /* **** FD xx       */
+OP(op,fd) { R++; EXEC_INLINE(fd,ROP());							} /* **** FD xx       */
 OP(op,fe) { CP(ARG());											} /* CP   n           */
 OP(op,ff) { RST(0x38);											} /* RST  7           */
 
@@ -3707,6 +3735,11 @@ void Z80SetCPUOpArgReadHandler(Z80ReadOpArgHandler handler)
 	Z80CPUReadOpArg = handler;
 }
 
+void Z80SetMemMap(UINT8 **map)
+{
+	Z80MemMap = map ? map : Z80NoMemMap;
+}
+
 int ActiveZ80GetPC()
 {
 	return Z80.pc.w.l;
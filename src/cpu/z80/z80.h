@@ -92,6 +92,11 @@ void Z80SetProgramWriteHandler(Z80WriteProgHandler handler);
 void Z80SetCPUOpReadHandler(Z80ReadOpHandler handler);
 void Z80SetCPUOpArgReadHandler(Z80ReadOpArgHandler handler);
 
+/* Pages of 0x100 bytes read, written, and fetched as opcodes and arguments
+ * directly, at 0x000, 0x100, 0x200 and 0x300 of the map; NULL pages (or a
+ * NULL map) go through the handlers above */
+void Z80SetMemMap(UINT8 **map);
+
 int ActiveZ80GetPC();
 int ActiveZ80GetBC();
 int ActiveZ80GetDE();
@@ -35,6 +35,11 @@ static INT32 nOpenedCPU = -1;
 static INT32 nCPUCount = 0;
 INT32 nHasZet = -1;
 
+static INT32 nZetIdleSlot[MAX_Z80];						// idle loop detection slot of each cpu (see burn_idle.cpp)
+
+static INT32 ZetIdleSkip();
+static UINT32 ZetIdleState();
+
 cpu_core_config ZetConfig =
 {
 	ZetOpen,
@@ -48,7 +53,9 @@ cpu_core_config ZetConfig =
 	ZetRunEnd,
 	ZetReset,
 	0x10000,
-	0
+	0,
+	ZetIdleSkip,
+	ZetIdleState
 };
 
 UINT8 __fastcall ZetDummyReadHandler(UINT16) { return 0; }
@@ -130,6 +137,67 @@ UINT8 __fastcall ZetReadOpArg(UINT32 a)
 	return 0;
 }
 
+// Idle loop detection: these take the place of the handlers above once a cpu is watched, and report
+// the accesses of the ones that are
+static UINT8 __fastcall ZetReadIOIdle(UINT32 a)
+{
+	UINT8 d = ZetReadIO(a);
+	if (nZetIdleSlot[nOpenedCPU] >= 0) BurnIdleRead(nZetIdleSlot[nOpenedCPU], a | 0x10000, d);
+	return d;
+}
+
+static void __fastcall ZetWriteIOIdle(UINT32 a, UINT8 d)
+{
+	ZetWriteIO(a, d);
+	if (nZetIdleSlot[nOpenedCPU] >= 0) BurnIdleWrite(nZetIdleSlot[nOpenedCPU]);
+}
+
+static UINT8 __fastcall ZetReadProgIdle(UINT32 a)
+{
+	UINT8 d = ZetReadProg(a);
+	if (nZetIdleSlot[nOpenedCPU] >= 0) BurnIdleRead(nZetIdleSlot[nOpenedCPU], a, d);
+	return d;
+}
+
+static void __fastcall ZetWriteProgIdle(UINT32 a, UINT8 d)
+{
+	ZetWriteProg(a, d);
+	if (nZetIdleSlot[nOpenedCPU] >= 0) BurnIdleWrite(nZetIdleSlot[nOpenedCPU]);
+}
+
+static UINT8 __fastcall ZetReadOpIdle(UINT32 a)
+{
+	if (nZetIdleSlot[nOpenedCPU] >= 0) BurnIdleFetch(nZetIdleSlot[nOpenedCPU], a);
+	return ZetReadOp(a);
+}
+
+// End the timeslice of the open cpu as if it was run (cpu_core_config.skip)
+static INT32 ZetIdleSkip()
+{
+	INT32 nCycles = z80_ICount > 0 ? z80_ICount : 0;
+
+	z80_ICount = 0;
+
+	return nCycles;
+}
+
+// Registers and flags of the open cpu, less the pc and R (cpu_core_config.state)
+static UINT32 ZetIdleState()
+{
+	Z80_Regs r;
+	Z80GetContext(&r);
+
+	UINT32 nHash = r.af.w.l | (r.bc.w.l << 16);
+	nHash = BurnIdleHash(nHash, r.de.w.l | (r.hl.w.l << 16));
+	nHash = BurnIdleHash(nHash, r.ix.w.l | (r.iy.w.l << 16));
+	nHash = BurnIdleHash(nHash, r.sp.w.l | (r.wz.w.l << 16));
+	nHash = BurnIdleHash(nHash, r.af2.w.l | (r.bc2.w.l << 16));
+	nHash = BurnIdleHash(nHash, r.de2.w.l | (r.hl2.w.l << 16));
+	nHash = BurnIdleHash(nHash, r.iff1 | (r.iff2 << 8) | (r.im << 16) | (r.i << 24));
+
+	return nHash;
+}
+
 void ZetSetReadHandler(UINT8 (__fastcall *pHandler)(UINT16))
 {
 #if defined FBA_DEBUG
@@ -243,6 +311,16 @@ INT32 ZetInit(INT32 nCPU)
 
 	CpuCheatRegister(nCPU, &ZetConfig);
 
+	nZetIdleSlot[nCPU] = BurnIdleRegister(&ZetConfig, "Z80", nCPU);
+
+	if (nZetIdleSlot[nCPU] >= 0) {
+		Z80SetIOReadHandler(ZetReadIOIdle);
+		Z80SetIOWriteHandler(ZetWriteIOIdle);
+		Z80SetProgramReadHandler(ZetReadProgIdle);
+		Z80SetProgramWriteHandler(ZetWriteProgIdle);
+		Z80SetCPUOpReadHandler(ZetReadOpIdle);
+	}
+
 	return 0;
 }
 
@@ -291,6 +369,7 @@ void ZetClose()
 	nZetCyclesDone[nOpenedCPU] = nZetCyclesTotal;
 	nZ80ICount[nOpenedCPU] = z80_ICount;
 	Z80EA[nOpenedCPU] = EA;
+	Z80SetMemMap(NULL);
 
 	nOpenedCPU = -1;
 }
@@ -305,6 +384,8 @@ void ZetOpen(INT32 nCPU)
 #endif
 
 	Z80SetContext(&ZetCPUContext[nCPU]->reg);
+	// the core reads mapped pages itself, except on cpus watched for idle loops, which see every access
+	Z80SetMemMap(nZetIdleSlot[nCPU] >= 0 ? NULL : ZetCPUContext[nCPU]->pZetMemMap);
 	nZetCyclesTotal = nZetCyclesDone[nCPU];
 	z80_ICount = nZ80ICount[nCPU];
 	EA = Z80EA[nCPU];
@@ -0,0 +1,168 @@
+/* FM check: replays random register logs on the YM2203, YM2608, YM2610 and YM2612 (key ons and
+   offs, frequencies with the 3 slot mode, algorithms, feedback, LFO, panning, SSG-EG, timers and
+   the DAC) with updates of random length, and hashes the output. The hashes were recorded with
+   the sample by sample update loops the channel-major blocks replaced. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver.h"
+#include "state.h"
+#include "fm.h"
+
+int ay8910_index_ym = 0;
+
+void AY8910_set_clock(int chip, int clock) { }
+void AY8910Write(int chip, int a, int data) { }
+int AY8910Read(int chip) { return 0; }
+void AY8910Reset(int chip) { }
+
+void BurnYM2203UpdateRequest(void) { }
+void BurnYM2608UpdateRequest(void) { }
+void BurnYM2610UpdateRequest(void) { }
+void BurnYM2612UpdateRequest(void) { }
+
+double BurnTimerGetTime(void) { return 0; }
+
+void state_save_register_func_postload(void (*pFunction)()) { }
+void state_save_register_INT8(const char* module, INT32 instance, const char* name, INT8* val, unsigned size) { }
+void state_save_register_UINT8(const char* module, INT32 instance, const char* name, UINT8* val, unsigned size) { }
+void state_save_register_INT16(const char* module, INT32 instance, const char* name, INT16* val, unsigned size) { }
+void state_save_register_UINT16(const char* module, INT32 instance, const char* name, UINT16* val, unsigned size) { }
+void state_save_register_INT32(const char* module, INT32 instance, const char* name, INT32* val, unsigned size) { }
+void state_save_register_UINT32(const char* module, INT32 instance, const char* name, UINT32* val, unsigned size) { }
+void state_save_register_int(const char* module, INT32 instance, const char* name, INT32* val) { }
+void state_save_register_double(const char* module, INT32 instance, const char* name, double* val, unsigned size) { }
+
+static UINT32 nSeed;
+
+static INT32 FMTestRandom(INT32 nRange)
+{
+	nSeed = nSeed * 1103515245 + 12345;
+	return (nSeed >> 8) % nRange;
+}
+
+static UINT32 FMTestHash(UINT32 nHash, INT16* pBuf, INT32 nLen)
+{
+	INT32 i;
+
+	for (i = 0; i < nLen; i++) {
+		nHash = (nHash ^ (UINT16)pBuf[i]) * 16777619;
+	}
+
+	return nHash;
+}
+
+static void FMTestWrite(INT32 nType, INT32 nPort, INT32 nReg, INT32 nData)
+{
+	switch (nType) {
+		case 0: YM2203Write(0, 0, nReg); YM2203Write(0, 1, nData); break;
+		case 1: YM2608Write(0, nPort * 2, nReg); YM2608Write(0, nPort * 2 + 1, nData); break;
+		case 2: YM2610Write(0, nPort * 2, nReg); YM2610Write(0, nPort * 2 + 1, nData); break;
+		case 3: YM2612Write(0, nPort * 2, nReg); YM2612Write(0, nPort * 2 + 1, nData); break;
+	}
+}
+
+static INT16 pLeft[1200], pRight[1200];
+static UINT8 pRom[0x10000];
+
+static UINT32 FMTestRun(INT32 nType, INT32 bSSGEG)
+{
+	UINT32 nHash = 2166136261u;
+	INT32 nRun, s;
+
+	for (nRun = 0; nRun < 20; nRun++) {
+		void* pa = pRom;
+		void* pb = pRom;
+		INT32 nSizeA = sizeof(pRom);
+		INT32 nSizeB = sizeof(pRom);
+
+		nSeed = nType * 1000 + nRun;
+
+		switch (nType) {
+			case 0: YM2203Init(1, 4000000, 44100, NULL, NULL); YM2203ResetChip(0); break;
+			case 1: YM2608Init(1, 8000000, 55466, &pa, &nSizeA, pRom, NULL, NULL); YM2608ResetChip(0); break;
+			case 2: YM2610Init(1, 8000000, 55555, &pa, &nSizeA, &pb, &nSizeB, NULL, NULL); YM2610ResetChip(0); break;
+			case 3: YM2612Init(1, 7670453, 53267, NULL, NULL); YM2612ResetChip(0); break;
+		}
+
+		for (s = 0; s < 400; s++) {
+			INT32 nWrites = FMTestRandom(8);
+			INT32 nLen;
+
+			while (nWrites--) {
+				INT32 nPort = nType ? FMTestRandom(2) : 0;
+				INT32 c = FMTestRandom(3);
+				INT32 nSlot = FMTestRandom(4);
+				INT32 nReg;
+
+				switch (FMTestRandom(14)) {
+					case 0: FMTestWrite(nType, 0, 0x28, (FMTestRandom(2) ? 0xf0 : FMTestRandom(16) << 4) | (nPort << 2) | c); break;
+					case 1: FMTestWrite(nType, 0, 0x28, (nPort << 2) | c); break;
+					case 2: FMTestWrite(nType, nPort, 0xa4 + c, FMTestRandom(0x40)); FMTestWrite(nType, nPort, 0xa0 + c, FMTestRandom(256)); break;
+					case 3: FMTestWrite(nType, 0, 0xac + c, FMTestRandom(0x40)); FMTestWrite(nType, 0, 0xa8 + c, FMTestRandom(256)); break;
+					case 4: FMTestWrite(nType, nPort, 0xb0 + c, FMTestRandom(256)); break;
+					case 5: FMTestWrite(nType, nPort, 0xb4 + c, FMTestRandom(256)); break;
+					case 6: FMTestWrite(nType, 0, 0x22, FMTestRandom(16)); break;
+					case 7: FMTestWrite(nType, 0, 0x27, FMTestRandom(2) ? 0x40 : 0); break;
+					case 8: if (bSSGEG && !FMTestRandom(4)) FMTestWrite(nType, nPort, 0x90 + nSlot * 4 + c, FMTestRandom(16)); break;
+					case 9: if (nType == 3) { FMTestWrite(nType, 0, 0x2b, FMTestRandom(2) << 7); FMTestWrite(nType, 0, 0x2a, FMTestRandom(256)); } break;
+					default:
+						nReg = 0x30 + FMTestRandom(6) * 0x10 + nSlot * 4 + c;
+						FMTestWrite(nType, nPort, nReg, (nReg >= 0x40 && nReg < 0x50) ? FMTestRandom(0x30) : FMTestRandom(256));
+						break;
+				}
+			}
+
+			nLen = FMTestRandom(3) ? FMTestRandom(40) : FMTestRandom(1200);
+			if (nLen) {
+				INT16* pBuf[2] = { pLeft, pRight };
+
+				switch (nType) {
+					case 0: YM2203UpdateOne(0, pLeft, nLen); break;
+					case 1: YM2608UpdateOne(0, pBuf, nLen); break;
+					case 2: YM2610UpdateOne(0, pBuf, nLen); break;
+					case 3: YM2612UpdateOne(0, pBuf, nLen); break;
+				}
+
+				nHash = FMTestHash(nHash, pLeft, nLen);
+				if (nType) {
+					nHash = FMTestHash(nHash, pRight, nLen);
+				}
+			}
+		}
+
+		switch (nType) {
+			case 0: YM2203Shutdown(); break;
+			case 1: YM2608Shutdown(); break;
+			case 2: YM2610Shutdown(); break;
+			case 3: YM2612Shutdown(); break;
+		}
+	}
+
+	return nHash;
+}
+
+int main()
+{
+	static const char* szNames[4] = { "YM2203", "YM2608", "YM2610", "YM2612" };
+	static const UINT32 nExpected[4][2] = { { 0xaf4a0007, 0xf151bf28 }, { 0x3a7b1e5f, 0x2424046f }, { 0xcbb40b62, 0x876cc2b5 }, { 0x41b509ec, 0xf5ac5b04 } };
+	INT32 nFailed = 0;
+	INT32 nType, bSSGEG;
+
+	for (nType = 0; nType < 4; nType++) {
+		for (bSSGEG = 0; bSSGEG < 2; bSSGEG++) {
+			UINT32 nHash = FMTestRun(nType, bSSGEG);
+
+			printf("  %s%s: %08x", szNames[nType], bSSGEG ? " with SSG-EG" : "", nHash);
+			if (nHash != nExpected[nType][bSSGEG]) {
+				printf(", expected %08x\n", nExpected[nType][bSSGEG]);
+				nFailed++;
+			} else {
+				printf(", ok\n");
+			}
+		}
+	}
+
+	return nFailed != 0;
+}
@@ -0,0 +1,113 @@
+// MSM6295 check: plays random commands on 1 to 3 chips with banked roms, random routes and
+// output rates, and hashes the mixing bus and the status after every segment. The hashes
+// were recorded with the sample by sample decoder the block decoder replaced.
+
+#include "burnint.h"
+#include "msm6295.h"
+#include "test.h"
+
+#define ROM_SIZE	0x40000
+
+static UINT32 MSM6295TestRun(INT32 nRuns)
+{
+	UINT32 nHash = TEST_HASH_INIT;
+	UINT8* pRom = (UINT8*)malloc(ROM_SIZE * 4);
+
+	for (INT32 nRun = 0; nRun < nRuns; nRun++) {
+		nTestSeed = nRun * 7919 + 1;
+		for (INT32 i = 0; i < ROM_SIZE * 4; i++) {
+			pRom[i] = TestRandom();
+		}
+
+		// sample tables with short samples, samples crossing the bank pages and samples up to the end of the rom
+		INT32 nChips = 1 + TestRandom() % 3;
+		for (INT32 c = 0; c < nChips; c++) {
+			UINT8* pTable = pRom + c * ROM_SIZE;
+			for (INT32 e = 1; e < 128; e++) {
+				UINT32 nStart = 0x400 + TestRandom() % 0x3fc00;
+				UINT32 nEnd = nStart + ((TestRandom() % 4 == 0) ? TestRandom() % 16 : TestRandom() % 0x4000);
+				if (nEnd > ROM_SIZE - 1) nEnd = ROM_SIZE - 1;
+				pTable[e * 8 + 0] = nStart >> 16; pTable[e * 8 + 1] = nStart >> 8; pTable[e * 8 + 2] = nStart;
+				pTable[e * 8 + 3] = nEnd >> 16; pTable[e * 8 + 4] = nEnd >> 8; pTable[e * 8 + 5] = nEnd;
+			}
+		}
+
+		static const INT32 nRates[] = { 11025, 22050, 44100, 48000 };
+		nBurnSoundRate = nRates[TestRandom() % 4];
+
+		// chip clocks both above and below the output rate
+		for (INT32 c = 0; c < nChips; c++) {
+			INT32 nClock = (TestRandom() % 4 == 0) ? 4000000 / 132 * (1 + TestRandom() % 8) : (1000000 + TestRandom() % 3000000) / ((TestRandom() & 1) ? 132 : 165);
+			MSM6295Init(c, nClock, c > 0 || (TestRandom() & 1));
+			MSM6295SetBank(c, pRom + c * ROM_SIZE, 0, ROM_SIZE - 1);
+			if (TestRandom() & 1) {
+				MSM6295SetBank(c, pRom + ((c + 1) & 3) * ROM_SIZE + 0x20000, 0x20000, ROM_SIZE - 1);
+			}
+			MSM6295SetRoute(c, (TestRandom() % 200) / 100.0, (TestRandom() % 3) + 1);
+		}
+		MSM6295Reset();
+
+		for (INT32 f = 0; f < 400; f++) {
+			INT32 nWrites = TestRandom() % 4;
+			for (INT32 w = 0; w < nWrites; w++) {
+				INT32 c = TestRandom() % nChips;
+				if (TestRandom() % 5 == 0) {
+					MSM6295Write(c, TestRandom() & 0x78);
+				} else {
+					MSM6295Write(c, 0x80 | (TestRandom() & 0x7f));
+					MSM6295Write(c, ((1 << (TestRandom() % 4)) << 4) | (TestRandom() & 15));
+				}
+				if (TestRandom() % 50 == 0) {
+					MSM6295SetSamplerate(c, 1000000 / 132 + TestRandom() % 20000);
+				}
+			}
+
+			INT32 nLen = 1 + TestRandom() % 3000;
+			INT16* pOut = (INT16*)malloc(nLen * 2 * sizeof(INT16));
+			MSM6295Render(pOut, nLen);
+			free(pOut);
+
+			for (INT32 i = 0; i < nLen; i++) {
+				nHash = TestHash(nHash, pBurnSoundBus[0][i]);
+				nHash = TestHash(nHash, pBurnSoundBus[1][i]);
+			}
+			for (INT32 c = 0; c < nChips; c++) {
+				nHash = TestHash(nHash, MSM6295Read(c));
+			}
+		}
+
+		MSM6295Exit();
+		BurnSoundBusExit();
+	}
+
+	free(pRom);
+
+	return nHash;
+}
+
+int main()
+{
+	static const UINT32 nExpected[2] = { 0x98eb9cc3, 0x09c1d712 };
+	INT32 nFailed = 0;
+
+	BurnInitMemoryManager();
+	cmc_4p_Precalc();
+
+	for (INT32 i = 0; i < 2; i++) {
+		nInterpolation = i ? 3 : 1;
+
+		UINT32 nHash = MSM6295TestRun(100);
+
+		printf("  %s: %08x", i ? "cubic" : "linear", nHash);
+		if (nHash != nExpected[i]) {
+			printf(", expected %08x\n", nExpected[i]);
+			nFailed++;
+		} else {
+			printf(", ok\n");
+		}
+	}
+
+	BurnExitMemoryManager();
+
+	return nFailed != 0;
+}
@@ -0,0 +1,137 @@
+// QSound check: plays a register trace like a CPS2 sound driver makes (key ons with looping and
+// one shot samples, pitch and volume slides, panning and key offs) with updates at random points
+// in the frame, and hashes the output. The hashes were recorded with the sample by sample loops
+// the span renderer replaced.
+
+#include "cps.h"
+#include "test.h"
+
+INT8* CpsQSam = NULL;
+UINT32 nCpsQSamLen = 0;
+INT32 nCpsZ80Cycles = 0;
+
+void QsndSyncZ80()
+{
+}
+
+INT32 ZetTotalCycles()
+{
+	return 0;
+}
+
+static void QscTestWrite()
+{
+	INT32 c = TestRandom() % 16;
+
+	switch (TestRandom() % 8) {
+		case 0:
+		case 1:
+		case 2: {
+			INT32 nStart = TestRandom() % 0xC000;
+			INT32 nLength = 0x10 + TestRandom() % 0x3000;
+			INT32 nLoop = (TestRandom() % 3) ? (1 + TestRandom() % (nLength - 4)) : 0;
+
+			QscWrite((((c - 1) & 15) << 3) | 0, TestRandom() % 0x20);
+			QscWrite((c << 3) | 1, nStart);
+			QscWrite((c << 3) | 5, nStart + nLength);
+			QscWrite((c << 3) | 4, nLoop);
+			QscWrite((c << 3) | 2, 0x400 + TestRandom() % 0x2000);
+			QscWrite(0x80 | c, 0x10 + TestRandom() % 0x21);
+			QscWrite((c << 3) | 6, 0);
+			QscWrite((c << 3) | 6, 0x1000 + TestRandom() % 0x7000);
+			break;
+		}
+		case 3:
+		case 4:
+			QscWrite((c << 3) | 2, 0x400 + TestRandom() % 0x2000);
+			break;
+		case 5:
+			QscWrite((c << 3) | 6, 1 + TestRandom() % 0x8000);
+			break;
+		case 6:
+			QscWrite(0x80 | c, 0x10 + TestRandom() % 0x21);
+			break;
+		case 7:
+			QscWrite((c << 3) | 6, 0);
+			break;
+	}
+}
+
+static UINT32 QscTestRun(INT16* pOut, INT32 nLen, INT32 nFrames)
+{
+	UINT32 nHash = TEST_HASH_INIT;
+
+	nTestSeed = 0x5153;
+	QscReset();
+
+	for (INT32 f = 0; f < nFrames; f++) {
+		QscNewFrame();
+
+		INT32 nWrites = TestRandom() % 6;
+		INT32 nWritePos = 0;
+		for (INT32 w = 0; w < nWrites; w++) {
+			nWritePos += TestRandom() % (nLen / (nWrites + 1));
+
+			pBurnSoundOut = pOut;
+			QscUpdate(nWritePos);
+			pBurnSoundOut = NULL;		// QscWrite() doesn't need to sync
+			QscTestWrite();
+		}
+
+		pBurnSoundOut = pOut;
+		QscUpdate(nLen);
+
+		for (INT32 i = 0; i < nLen * 2; i++) {
+			nHash = TestHash(nHash, (UINT16)pOut[i]);
+		}
+	}
+
+	return nHash;
+}
+
+int main()
+{
+	static const INT32 nModes[2] = { 1, 3 };
+	static const UINT32 nExpected[2] = { 0xcbea636e, 0x51b53d4a };
+	const INT32 nLen = 735;				// 44100hz at 60fps
+	const INT32 nSamLen = 0x200000;
+	INT32 nFailed = 0;
+
+	BurnInitMemoryManager();
+	cmc_4p_Precalc();
+
+	CpsQSam = (INT8*)BurnMalloc(nSamLen);
+	for (INT32 i = 0; i < nSamLen; i++) {
+		CpsQSam[i] = (INT8)(sin(i * (0.01 + (i >> 16) * 0.005)) * 100.0) + (i * 7 % 13) - 6;
+	}
+	nCpsQSamLen = nSamLen;
+
+	INT16* pOut = (INT16*)BurnMalloc(nLen * 2 * sizeof(INT16));
+
+	nBurnSoundRate = 44100;
+	nBurnSoundLen = nLen;
+	QscInit(nBurnSoundRate);
+
+	for (INT32 m = 0; m < 2; m++) {
+		nInterpolation = nModes[m];
+
+		UINT32 nHash = QscTestRun(pOut, nLen, 600);
+
+		printf("  interpolation %d: %08x", nModes[m], nHash);
+		if (nHash != nExpected[m]) {
+			printf(", expected %08x\n", nExpected[m]);
+			nFailed++;
+		} else {
+			printf(", ok\n");
+		}
+	}
+
+	QscExit();
+
+	BurnFree(pOut);
+	BurnFree(CpsQSam);
+
+	BurnExitMemoryManager();
+
+	return nFailed != 0;
+}
@@ -0,0 +1,219 @@
+// SH-2 recompiler check: runs random programs (weighted towards the instructions the recompiler
+// handles, with branches, busy loops and accesses to memory handlers) on the interpreter and then
+// with the x64 recompiler, with irqs, eaten cycles and pc changes between timeslices, and compares
+// the registers, cycle counts, ram and the handler accesses.
+
+#include "burnint.h"
+#include "sh2_intf.h"
+#include "sh2/sh2_internal.h"
+#include "test.h"
+
+#define RAM_SIZE	0x100000
+#define FRAMES		200
+
+static UINT8 Ram[RAM_SIZE * 2];		// the interpreter fetches past the end of a page until the next branch
+
+static SH2* pState;
+static INT32* pSuspend;
+
+static UINT32 nLog;
+static UINT32 nCalls;
+
+static INT32 __cdecl Sh2TestAcb(struct BurnArea* pba)
+{
+	if (pState == NULL) {
+		pState = (SH2*)pba->Data;
+	} else if (pSuspend == NULL) {
+		pSuspend = (INT32*)pba->Data;
+	}
+
+	return 0;
+}
+
+// every handler access goes in the log with the cycle count it was made at
+static void Sh2TestLog(UINT32 a, UINT32 d, UINT32 nType)
+{
+	nCalls++;
+	nLog = TestHash(nLog, a);
+	nLog = TestHash(nLog, d);
+	nLog = TestHash(nLog, Sh2TotalCycles());
+	nLog = TestHash(nLog, nType);
+}
+
+static UINT8 __fastcall Sh2TestReadByte(UINT32 a) { Sh2TestLog(a, 0, 1); return (UINT8)(a * 7 + nCalls); }
+static UINT16 __fastcall Sh2TestReadWord(UINT32 a) { Sh2TestLog(a, 0, 2); return (UINT16)(a * 13 + nCalls); }
+static UINT32 __fastcall Sh2TestReadLong(UINT32 a) { Sh2TestLog(a, 0, 3); return (a * 31 + nCalls) % RAM_SIZE; }
+static void __fastcall Sh2TestWriteByte(UINT32 a, UINT8 d) { Sh2TestLog(a, d, 4); }
+static void __fastcall Sh2TestWriteWord(UINT32 a, UINT16 d) { Sh2TestLog(a, d, 5); }
+static void __fastcall Sh2TestWriteLong(UINT32 a, UINT32 d) { Sh2TestLog(a, d, 6); }
+
+struct Sh2TestResult {
+	UINT32 nTrace[FRAMES][4];
+	UINT8 Ram[RAM_SIZE];
+	SH2 State;
+	INT32 nSuspend;
+	UINT32 nLog;
+	UINT32 nCalls;
+};
+
+static UINT16 Sh2TestOpcode()
+{
+	static const UINT16 nOps[] = {
+		0x6003, 0x7000, 0xe000, 0x300c, 0x3008, 0x2009, 0x200b, 0x200a, 0x2008, 0x3000, 0x3003, 0x3007, 0x3002, 0x3006, 0x300e, 0x300a,
+		0x6002, 0x6001, 0x6000, 0x6006, 0x6005, 0x6004, 0x2002, 0x2001, 0x2000, 0x2006, 0x2005, 0x2004, 0x5000, 0x1000, 0x8400, 0x8500,
+		0x8000, 0x8100, 0xc400, 0xc500, 0xc600, 0xc000, 0xc100, 0xc200, 0x9000, 0xd000, 0xc700, 0x000c, 0x000d, 0x000e, 0x0004, 0x0005,
+		0x0006, 0x8900, 0x8b00, 0x8d00, 0x8f00, 0xa000, 0xb000, 0x4010, 0x4000, 0x4001, 0x4021, 0x4004, 0x4005, 0x4024, 0x4025, 0x4008,
+		0x4009, 0x4018, 0x4019, 0x4028, 0x4029, 0x4011, 0x4015, 0x4002, 0x4012, 0x4022, 0x4003, 0x4013, 0x4023, 0x4006, 0x4016, 0x4026,
+		0x4017, 0x4027, 0x400a, 0x401a, 0x402a, 0x401e, 0x402e, 0x400b, 0x402b, 0x0003, 0x0023, 0x000b, 0x0002, 0x0012, 0x0022, 0x000a,
+		0x001a, 0x002a, 0x0007, 0x0008, 0x0018, 0x0019, 0x0028, 0x0029, 0x600f, 0x600e, 0x600d, 0x600c, 0x600b, 0x600a, 0x6009, 0x6008,
+		0x6007, 0x200d, 0x200e, 0x200f, 0x3005, 0x300d, 0x2007, 0x2004, 0x3004, 0x300b, 0x300f, 0x200c, 0xc800, 0xc900, 0xca00, 0xcb00,
+		0x8800, 0x0009
+	};
+
+	if (TestRandom() % 100 < 25) {
+		UINT16 nOp = TestRandom();
+		return (nOp == 0x001b) ? 0x0009 : nOp;	// no SLEEP
+	}
+
+	UINT16 nOp = nOps[TestRandom() % (sizeof(nOps) / sizeof(nOps[0]))];
+
+	// fill in the register and immediate fields, branches stay close
+	nOp |= TestRandom() & (((nOp >= 0x7000 && nOp < 0x8000) || nOp >= 0x9000 || (nOp & 0xff00) == 0xc000) ? 0x0fff : 0x0ff0);
+	if ((nOp & 0xf000) == 0x8000 || ((nOp & 0xff00) >= 0xc000 && nOp < 0xd000)) nOp = (nOp & 0xff00) | (TestRandom() & 0xff);
+	if ((nOp & 0xf000) == 0xa000 || (nOp & 0xf000) == 0xb000) nOp = (nOp & 0xf000) | ((TestRandom() % 64 - 32) & 0xfff);
+	if ((nOp & 0xff00) >= 0x8900 && (nOp & 0xff00) < 0x9000) nOp = (nOp & 0xff00) | ((TestRandom() % 64 - 32) & 0xff);
+
+	return nOp;
+}
+
+static void Sh2TestWriteOp(UINT32 a, UINT16 nOp)
+{
+	*(UINT16*)(Ram + (a ^ 2)) = nOp;
+}
+
+static void Sh2TestRun(INT32 nMode, UINT32 nSeed, Sh2TestResult* pResult)
+{
+	sh2_drc_mode = nMode;
+	nTestSeed = nSeed;
+
+	for (INT32 i = 0; i < RAM_SIZE; i += 2) {
+		Sh2TestWriteOp(i, Sh2TestOpcode());
+	}
+	for (INT32 i = RAM_SIZE; i < RAM_SIZE * 2; i += 4) {
+		Sh2TestWriteOp(i, 0xa800);		// BRA back into ram
+		Sh2TestWriteOp(i + 2, 0x0009);
+	}
+
+	// BRA $ and DT / BF busy loops
+	for (INT32 i = 0; i < 50; i++) {
+		UINT32 a = (0x2000 + TestRandom() % (RAM_SIZE - 0x3000)) & ~1;
+		Sh2TestWriteOp(a, 0xaffe);
+		Sh2TestWriteOp(a + 2, 0x0009);
+	}
+	for (INT32 i = 0; i < 50; i++) {
+		UINT32 a = (0x2000 + TestRandom() % (RAM_SIZE - 0x3000)) & ~1;
+		Sh2TestWriteOp(a, 0x4110);
+		Sh2TestWriteOp(a + 2, 0x8bfd);
+	}
+
+	pState = NULL;
+	pSuspend = NULL;
+	nLog = TEST_HASH_INIT;
+	nCalls = 0;
+
+	Sh2Init(1);
+	Sh2Open(0);
+	Sh2MapMemory(Ram, 0, RAM_SIZE - 1, MAP_RAM);
+	Sh2MapHandler(1, RAM_SIZE, 0x3fffffff, MAP_RAM);
+	Sh2MapHandler(1, 0xc0000000, 0xdfffffff, MAP_RAM);
+	Sh2MapHandler(1, 0xe0000000, 0xffffffff, MAP_RAM);
+	Sh2SetReadByteHandler(1, Sh2TestReadByte);
+	Sh2SetReadWordHandler(1, Sh2TestReadWord);
+	Sh2SetReadLongHandler(1, Sh2TestReadLong);
+	Sh2SetWriteByteHandler(1, Sh2TestWriteByte);
+	Sh2SetWriteWordHandler(1, Sh2TestWriteWord);
+	Sh2SetWriteLongHandler(1, Sh2TestWriteLong);
+	Sh2Reset(0x2000, RAM_SIZE - 0x100);
+
+	BurnAcb = Sh2TestAcb;
+	Sh2Scan(ACB_DRIVER_DATA);
+
+	for (INT32 i = 0; i < 15; i++) {
+		pState->r[i] = (TestRandom() % 9 == 0) ? TestRandom() * 0x10001 : (TestRandom() % RAM_SIZE);
+	}
+	pState->vbr = 0x1000;
+	for (INT32 i = 0; i < 256; i++) {
+		*(UINT32*)(Ram + 0x1000 + i * 4) = (0x2000 + TestRandom() % (RAM_SIZE - 0x4000)) & ~1;
+	}
+
+	for (INT32 f = 0; f < FRAMES; f++) {
+		if ((f % 7) == 3) Sh2SetIRQLine(3 + f % 10, CPU_IRQSTATUS_ACK);
+		if ((f % 7) == 5) Sh2SetIRQLine(3 + (f - 2) % 10, CPU_IRQSTATUS_NONE);
+		if ((f % 13) == 0) Sh2SetEatCycles(1 + (f / 13) % 3);
+		if ((f % 29) == 7) {
+			// a jump the way a state load makes one
+			pState->pc = (0x2000 + TestRandom() % (RAM_SIZE - 0x4000)) & ~1;
+			pState->delay = 0;
+			Sh2Scan(ACB_DRIVER_DATA | ACB_WRITE);
+		}
+
+		Sh2Run(500 + f % 300);
+
+		pResult->nTrace[f][0] = pState->pc;
+		pResult->nTrace[f][1] = pState->sh2_total_cycles;
+		pResult->nTrace[f][2] = nCalls;
+		pResult->nTrace[f][3] = pState->r[0];
+	}
+
+	memcpy(pResult->Ram, Ram, RAM_SIZE);
+	pResult->State = *pState;
+	pResult->nSuspend = *pSuspend;
+	pResult->nLog = nLog;
+	pResult->nCalls = nCalls;
+
+	BurnAcb = NULL;
+	Sh2Exit();
+}
+
+static bool Sh2TestCompare(const Sh2TestResult* a, const Sh2TestResult* b)
+{
+	return !memcmp(a->Ram, b->Ram, RAM_SIZE) && a->nLog == b->nLog && a->nCalls == b->nCalls && a->nSuspend == b->nSuspend
+		&& !memcmp(a->State.r, b->State.r, sizeof(a->State.r)) && a->State.pc == b->State.pc && a->State.sr == b->State.sr
+		&& a->State.pr == b->State.pr && a->State.gbr == b->State.gbr && a->State.vbr == b->State.vbr
+		&& a->State.mach == b->State.mach && a->State.macl == b->State.macl
+		&& a->State.sh2_total_cycles == b->State.sh2_total_cycles && a->State.cycle_counts == b->State.cycle_counts;
+}
+
+static Sh2TestResult Interpreter, Recompiler;
+
+int main()
+{
+	const INT32 nSeeds = 100;
+	INT32 nFailed = 0;
+
+	BurnInitMemoryManager();
+
+	for (INT32 s = 1; s <= nSeeds; s++) {
+		Sh2TestRun(SH2_DRC_OFF, s, &Interpreter);
+		Sh2TestRun(SH2_DRC_ON, s, &Recompiler);
+
+		if (!Sh2TestCompare(&Interpreter, &Recompiler)) {
+			nFailed++;
+
+			for (INT32 f = 0; f < FRAMES; f++) {
+				if (memcmp(Interpreter.nTrace[f], Recompiler.nTrace[f], sizeof(Interpreter.nTrace[f]))) {
+					printf("  seed %d differs from timeslice %d: pc %08x/%08x cycles %u/%u handler calls %u/%u r0 %08x/%08x\n", s, f,
+						Interpreter.nTrace[f][0], Recompiler.nTrace[f][0], Interpreter.nTrace[f][1], Recompiler.nTrace[f][1],
+						Interpreter.nTrace[f][2], Recompiler.nTrace[f][2], Interpreter.nTrace[f][3], Recompiler.nTrace[f][3]);
+					break;
+				}
+			}
+		}
+	}
+
+	printf("  %d of %d programs differ, %u handler calls in the last\n", nFailed, nSeeds, Interpreter.nCalls);
+
+	BurnExitMemoryManager();
+
+	return nFailed != 0;
+}
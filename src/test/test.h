@@ -0,0 +1,18 @@
+// Helpers shared by the core checks
+
+// repeatable pseudo random numbers for generating the input
+static UINT32 nTestSeed = 1;
+
+static inline UINT32 TestRandom()
+{
+	nTestSeed = nTestSeed * 1103515245 + 12345;
+	return nTestSeed >> 8;
+}
+
+// FNV-1a over the values checked
+static inline UINT32 TestHash(UINT32 nHash, UINT32 nValue)
+{
+	return (nHash ^ nValue) * 16777619;
+}
+
+#define TEST_HASH_INIT	2166136261u
@@ -0,0 +1,35 @@
+// Stand-ins for the parts of the emulator the core checks don't link
+
+#include "burnint.h"
+#include <stdarg.h>
+
+static INT32 __cdecl TestPrintf(INT32, TCHAR* szFormat, ...)
+{
+	va_list vp;
+
+	va_start(vp, szFormat);
+	vprintf(szFormat, vp);
+	va_end(vp);
+
+	return 0;
+}
+
+INT32 (__cdecl *bprintf)(INT32 nStatus, TCHAR* szFormat, ...) = TestPrintf;
+INT32 (__cdecl *BurnAcb)(struct BurnArea* pba) = NULL;
+
+INT32 nBurnSoundRate = 44100;
+INT32 nBurnSoundLen = 0;
+INT16* pBurnSoundOut = NULL;
+INT32 nInterpolation = 1;
+INT32 nFMInterpolation = 0;
+
+UINT32 nCurrentFrame = 0;
+
+void CpuCheatRegister(INT32, cpu_core_config*)
+{
+}
+
+char* BurnDrvGetTextA(UINT32)
+{
+	return NULL;
+}
@@ -0,0 +1,142 @@
+// Z80 check: runs random programs on two Z80s (one with separate opcode pages, one all ram),
+// every other program with a tight loop of block moves, calls and indexed accesses at the reset
+// vector, with memory and port handlers, irqs and nmis. The registers and cycle counts are hashed
+// after every timeslice and the ram at the end, with the idle loop detection off and on. The
+// hashes were recorded with the core before it read the page map itself.
+
+#include "burnint.h"
+#include "z80_intf.h"
+#include "test.h"
+
+static UINT8 Rom0[0x8000], Op0[0x4000], Ram0[0x4000], Ram1[0xe000];
+static UINT32 nHash;
+
+static UINT8 __fastcall Z80TestRead(UINT16 a) { return (UINT8)((a * 13) ^ (nHash >> 7)); }
+static void __fastcall Z80TestWrite(UINT16 a, UINT8 d) { nHash = TestHash(nHash, a << 8 | d); }
+static UINT8 __fastcall Z80TestIn(UINT16 a) { return (UINT8)(a ^ (nHash >> 3)); }
+static void __fastcall Z80TestOut(UINT16 a, UINT8 d) { nHash = TestHash(nHash, 0x1000000 | a << 8 | d); }
+
+static UINT8 Z80TestByte()
+{
+	UINT8 nByte = TestRandom() >> 8;
+
+	return (nByte == 0x76) ? 0 : nByte;		// no HALT
+}
+
+static UINT32 Z80TestRun(INT32 nPrograms, INT32 nTimeslices)
+{
+	UINT32 nTotal = 0;
+
+	for (INT32 s = 0; s < nPrograms; s++) {
+		nTestSeed = s + 1;
+		nHash = TEST_HASH_INIT;
+
+		for (INT32 i = 0; i < 0x8000; i++) Rom0[i] = Z80TestByte();
+		for (INT32 i = 0; i < 0x4000; i++) { Op0[i] = Z80TestByte(); Ram0[i] = Z80TestByte(); }
+		for (INT32 i = 0; i < 0xe000; i++) Ram1[i] = Z80TestByte();
+
+		if (s & 1) {
+			// poll a latch, copy with ldir, djnz, indexed accesses and a call
+			static const UINT8 Prg[] = {
+				0x31, 0x00, 0xc0, 0x21, 0x00, 0x80, 0x11, 0x00, 0x90, 0x01, 0x00, 0x01, 0xed, 0xb0, 0x06, 0x40,
+				0x3a, 0x00, 0x81, 0x86, 0x23, 0x77, 0x10, 0xf9, 0xdb, 0x10, 0xdd, 0x21, 0x00, 0x80, 0xdd, 0x7e,
+				0x05, 0xcb, 0x47, 0xfd, 0x21, 0x10, 0x80, 0xfd, 0x77, 0x02, 0xcd, 0x40, 0x00, 0xc3, 0x03, 0x00
+			};
+			static const UINT8 Sub[] = { 0xf5, 0xc5, 0x3a, 0x00, 0xc0, 0xd3, 0x20, 0xc1, 0xf1, 0xc9 };
+
+			memcpy(Rom0, Prg, sizeof(Prg));
+			memcpy(Op0, Prg, sizeof(Prg));
+			memcpy(Rom0 + 0x40, Sub, sizeof(Sub));
+			memcpy(Op0 + 0x40, Sub, sizeof(Sub));
+		}
+
+		BurnIdleInit();
+
+		for (INT32 c = 0; c < 2; c++) {
+			ZetInit(c);
+			ZetOpen(c);
+			if (c == 0) {
+				ZetMapMemory(Rom0, 0x0000, 0x7fff, MAP_ROM);
+				ZetMapMemory(Op0, 0x0000, 0x3fff, MAP_FETCHOP);
+				ZetMapMemory(Ram0, 0x8000, 0xbfff, MAP_RAM);
+			} else {
+				ZetMapMemory(Ram1, 0x0000, 0xdfff, MAP_RAM);
+			}
+			ZetSetReadHandler(Z80TestRead);
+			ZetSetWriteHandler(Z80TestWrite);
+			ZetSetInHandler(Z80TestIn);
+			ZetSetOutHandler(Z80TestOut);
+			ZetReset();
+			ZetClose();
+		}
+
+		for (INT32 n = 0; n < nTimeslices; n++) {
+			for (INT32 c = 0; c < 2; c++) {
+				ZetOpen(c);
+
+				if (n % 7 == c) ZetSetIRQLine(0, CPU_IRQSTATUS_HOLD);
+				if (n % 53 == 3) ZetNmi();
+
+				nHash = TestHash(nHash, ZetRun(997 + c * 500));
+				nHash = TestHash(nHash, ZetTotalCycles());
+				nHash = TestHash(nHash, ZetGetPC(-1));
+				nHash = TestHash(nHash, ZetSP(-1));
+				nHash = TestHash(nHash, ZetBc(-1));
+				nHash = TestHash(nHash, ZetDe(-1));
+				nHash = TestHash(nHash, ZetHL(-1));
+				nHash = TestHash(nHash, ZetI(-1));
+
+				Z80_Regs Regs;
+				Z80GetContext(&Regs);
+				nHash = TestHash(nHash, Regs.af.d);
+				nHash = TestHash(nHash, Regs.ix.d);
+				nHash = TestHash(nHash, Regs.iy.d);
+				nHash = TestHash(nHash, Regs.af2.d);
+				nHash = TestHash(nHash, Regs.bc2.d);
+				nHash = TestHash(nHash, Regs.de2.d);
+				nHash = TestHash(nHash, Regs.hl2.d);
+				nHash = TestHash(nHash, Regs.wz.d);
+				nHash = TestHash(nHash, Regs.r | Regs.r2 << 8 | Regs.iff1 << 16 | Regs.iff2 << 24);
+				nHash = TestHash(nHash, Regs.halt | Regs.im << 8 | Regs.irq_state << 16);
+
+				ZetClose();
+			}
+		}
+
+		for (INT32 i = 0; i < 0x4000; i++) nHash = TestHash(nHash, Ram0[i]);
+		for (INT32 i = 0; i < 0xe000; i++) nHash = TestHash(nHash, Ram1[i]);
+
+		ZetExit();
+		BurnIdleExit();
+
+		nTotal = TestHash(nTotal, nHash);
+	}
+
+	return nTotal;
+}
+
+int main()
+{
+	static const UINT32 nExpected[2] = { 0x7ddc7ac7, 0x18027ae6 };
+	INT32 nFailed = 0;
+
+	BurnInitMemoryManager();
+
+	for (INT32 i = 0; i < 2; i++) {
+		nBurnIdleMode = i ? 2 : 0;
+
+		UINT32 nHash = Z80TestRun(60, 2000);
+
+		printf("  idle detection %s: %08x", i ? "on" : "off", nHash);
+		if (nHash != nExpected[i]) {
+			printf(", expected %08x\n", nExpected[i]);
+			nFailed++;
+		} else {
+			printf(", ok\n");
+		}
+	}
+
+	BurnExitMemoryManager();
+
+	return nFailed != 0;
+}